@@ -134,10 +134,10 @@ def default(indicator):
             {f"{n}".join(f'inputs[{i}] = Marshal.AllocHGlobal(sizeof(double) * window.Count);' for i, input in enumerate(inputs))}
             {f"{n}".join(f'{{ int i = 0; foreach ({input_type} value in window) {{ tmp[window.Count-i-1] = (double)value.{input.capitalize() if not series else "Value"}; i += 1; }} }}' for i, input in enumerate(inputs))}
             {f"{n}".join(f'Marshal.Copy(tmp, 0, inputs[{i}], window.Count);' for i, input in enumerate(inputs))}
-            {f"{n}".join(f'outputs[{i}] = Marshal.AllocHGlobal(sizeof(double) * (window.Count - start));' for i, output in enumerate(outputs))}
-            int result = ti_{name}(window.Count, inputs, options, outputs);
+            {f"{n}".join(f'outputs[{i}] = Marshal.AllocHGlobal(sizeof(double));' for i, output in enumerate(outputs))}
+            int result = ti_{name}_range(window.Count, inputs, options, window.Count - start - 1, 1, outputs);
             util.DispatchError(result);
-            {f"{n}".join(f'Marshal.Copy(outputs[{i}], tmp, 0, window.Count - start); {output.upper()}.Update(data.Time, (decimal)tmp[window.Count-start-1]);' for i, output in enumerate(outputs))}
+            {f"{n}".join(f'Marshal.Copy(outputs[{i}], tmp, 0, 1); {output.upper()}.Update(data.Time, (decimal)tmp[0]);' for i, output in enumerate(outputs))}
             foreach (IntPtr input in inputs) {{ Marshal.FreeHGlobal(input); }}
             foreach (IntPtr output in outputs) {{ Marshal.FreeHGlobal(output); }}
             return {outputs[0].upper()}.Current.Value;
@@ -146,7 +146,7 @@ def default(indicator):
             get {{ return ready; }}
         }}
         {dllimport.format(fun=f'ti_{name}_start', ret='int', args='double[] options')}
-        {dllimport.format(fun=f'ti_{name}', ret='int', args='int size, IntPtr[] inputs, double[] options, IntPtr[] outputs')}
+        {dllimport.format(fun=f'ti_{name}_range', ret='int', args='int size, IntPtr[] inputs, double[] options, int first_output, int count, IntPtr[] outputs')}
     }}
     '''
     return result
@@ -48,6 +48,16 @@ class ti_indicator_info(Structure):
         ("stream_new", c_void_p),
         ("stream_run", c_void_p),
         ("stream_free", c_void_p),
+        ("batch_new", c_void_p),
+        ("batch_run", c_void_p),
+        ("batch_free", c_void_p),
+        ("indicator_multi", c_void_p),
+        ("indicator_range", c_void_p),
+        ("stream_save", c_void_p),
+        ("stream_load", c_void_p),
+        ("stream_clone", c_void_p),
+        ("stream_clone_into", c_void_p),
+        ("stream_peek", c_void_p),
     ]
 
 
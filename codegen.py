@@ -28,12 +28,32 @@ def declaration_plain(name):
     return f'int ti_{name}(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs)'
 def declaration_ref(name, opt_pragma=True):
     return 'DONTOPTIMIZE'*int(opt_pragma) + f'int ti_{name}_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs)'
+def declaration_range(name):
+    return f'int ti_{name}_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs)'
+def declaration_multi(name):
+    return f'int ti_{name}_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs)'
 def declaration_stream_new(name):
     return f'int ti_{name}_stream_new(TI_REAL const *options, ti_stream **stream)'
 def declaration_stream_run(name):
     return f'int ti_{name}_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs)'
 def declaration_stream_free(name):
     return f'void ti_{name}_stream_free(ti_stream *stream)'
+def declaration_stream_save(name):
+    return f'size_t ti_{name}_stream_save(ti_stream *stream, void *buf)'
+def declaration_stream_load(name):
+    return f'int ti_{name}_stream_load(void const *buf, size_t size, ti_stream **stream)'
+def declaration_stream_peek(name):
+    return f'int ti_{name}_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs)'
+def declaration_stream_clone(name):
+    return f'int ti_{name}_stream_clone(ti_stream const *stream, ti_stream **clone)'
+def declaration_stream_clone_into(name):
+    return f'int ti_{name}_stream_clone_into(ti_stream const *stream, ti_stream *clone)'
+def declaration_batch_new(name):
+    return f'int ti_{name}_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch)'
+def declaration_batch_run(name):
+    return f'int ti_{name}_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs)'
+def declaration_batch_free(name):
+    return f'void ti_{name}_batch_free(ti_batch *batch)'
 
 
 with open(path_prefix+'indicators.h', 'w') as f:
@@ -50,11 +70,24 @@ with open(path_prefix+'indicators.h', 'w') as f:
             f'DLLEXPORT extern {declaration_plain(name)};',
         ] + ([
             f'DLLEXPORT extern {declaration_ref(name, opt_pragma=False)};',
-        ] if 'ref' in features else []) + ([
+        ] if 'ref' in features else []) + [
+            f'DLLEXPORT extern {declaration_range(name)};',
+        ] + ([
+            f'DLLEXPORT extern {declaration_multi(name)};',
+        ] if 'multi' in features else []) + ([
             f'DLLEXPORT extern {declaration_stream_new(name)};',
             f'DLLEXPORT extern {declaration_stream_run(name)};',
             f'DLLEXPORT extern {declaration_stream_free(name)};',
-        ] if 'stream' in features else []) + [
+            f'DLLEXPORT extern {declaration_stream_peek(name)};',
+            f'DLLEXPORT extern {declaration_stream_save(name)};',
+            f'DLLEXPORT extern {declaration_stream_load(name)};',
+            f'DLLEXPORT extern {declaration_stream_clone(name)};',
+            f'DLLEXPORT extern {declaration_stream_clone_into(name)};',
+        ] if 'stream' in features else []) + ([
+            f'DLLEXPORT extern {declaration_batch_new(name)};',
+            f'DLLEXPORT extern {declaration_batch_run(name)};',
+            f'DLLEXPORT extern {declaration_batch_free(name)};',
+        ] if 'batch' in features else []) + [
             ''
         ])
         return result
@@ -105,9 +138,28 @@ with open(path_prefix+'indicators.h', 'w') as f:
         'struct ti_stream { int index; int progress; }; typedef struct ti_stream ti_stream;',
         'typedef int (*ti_indicator_start_function)(TI_REAL const *options);',
         'typedef int (*ti_indicator_function)(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs);',
+        '/* Writes only the outputs first_output..first_output+count-1 of the plain function, to outputs[j][0..count-1] */',
+        'typedef int (*ti_indicator_range_function)(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs);',
+        '/* options is an nparams x (number of options) matrix, the p-th row is written to outputs[j] + p*size */',
+        'typedef int (*ti_indicator_multi_function)(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs);',
         'typedef int (*ti_indicator_stream_new)(TI_REAL const *options, ti_stream **stream);',
         'typedef int (*ti_indicator_stream_run)(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
         'typedef void (*ti_indicator_stream_free)(ti_stream *stream);',
+        '/* Computes the outputs for one provisional bar inputs[j][0] without committing it to the stream; */',
+        '/* outputs[j][0] is written only if the bar would produce an output, i.e. if progress >= 0 */',
+        'typedef int (*ti_indicator_stream_peek)(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
+        '/* Writes the state to buf and returns its size in bytes; with buf == 0 only returns the size */',
+        'typedef size_t (*ti_indicator_stream_save)(ti_stream *stream, void *buf);',
+        'typedef int (*ti_indicator_stream_load)(void const *buf, size_t size, ti_stream **stream);',
+        'typedef int (*ti_indicator_stream_clone)(ti_stream const *stream, ti_stream **clone);',
+        'typedef int (*ti_indicator_stream_clone_into)(ti_stream const *stream, ti_stream *clone);',
+        '',
+        '/* A batch advances nsymbols independent instruments by one bar per call. */',
+        '/* inputs[j][s] is the j-th input of the s-th symbol, outputs[j][s] likewise. */',
+        'struct ti_batch { int index; int progress; int nsymbols; }; typedef struct ti_batch ti_batch;',
+        'typedef int (*ti_indicator_batch_new)(TI_REAL const *options, int nsymbols, ti_batch **batch);',
+        'typedef int (*ti_indicator_batch_run)(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
+        'typedef void (*ti_indicator_batch_free)(ti_batch *batch);',
         '',
         'typedef struct ti_indicator_info {',
         '    char *name;',
@@ -122,6 +174,16 @@ with open(path_prefix+'indicators.h', 'w') as f:
         '    ti_indicator_stream_new stream_new;',
         '    ti_indicator_stream_run stream_run;',
         '    ti_indicator_stream_free stream_free;',
+        '    ti_indicator_batch_new batch_new;',
+        '    ti_indicator_batch_run batch_run;',
+        '    ti_indicator_batch_free batch_free;',
+        '    ti_indicator_multi_function indicator_multi;',
+        '    ti_indicator_range_function indicator_range;',
+        '    ti_indicator_stream_save stream_save;',
+        '    ti_indicator_stream_load stream_load;',
+        '    ti_indicator_stream_clone stream_clone;',
+        '    ti_indicator_stream_clone_into stream_clone_into;',
+        '    ti_indicator_stream_peek stream_peek;',
         '} ti_indicator_info;',
         '',
         f'#define TI_INDICATOR_COUNT {len(indicators)}',
@@ -132,6 +194,36 @@ with open(path_prefix+'indicators.h', 'w') as f:
         'DLLEXPORT extern ti_indicator_info *ti_stream_get_info(ti_stream *stream);',
         'DLLEXPORT extern int ti_stream_get_progress(ti_stream *stream);',
         'DLLEXPORT extern void ti_stream_free(ti_stream *stream);',
+        'DLLEXPORT extern int ti_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
+        '',
+        '/* A saved stream is a 48-byte header (magic, format version, indicator name, payload size) */',
+        '/* followed by the payload, padded to a multiple of 8 bytes, so that saved streams can be laid */',
+        '/* back to back in one file. ti_stream_load does not keep a reference to buf. */',
+        '#define TI_STREAM_FORMAT_VERSION 1',
+        'DLLEXPORT extern size_t ti_stream_serialized_size(ti_stream *stream);',
+        'DLLEXPORT extern int ti_stream_save(ti_stream *stream, void *buf);',
+        'DLLEXPORT extern int ti_stream_load(void const *buf, ti_stream **stream);',
+        '',
+        '/* ti_stream_clone makes a deep copy of the stream. ti_stream_clone_into overwrites clone, a stream */',
+        '/* of the same indicator, with a copy of stream, reusing its buffers: it does not allocate when both */',
+        '/* were created with the same options. On failure clone is left valid but unspecified. */',
+        'DLLEXPORT extern int ti_stream_clone(ti_stream const *stream, ti_stream **clone);',
+        'DLLEXPORT extern int ti_stream_clone_into(ti_stream const *stream, ti_stream *clone);',
+        '',
+        'DLLEXPORT extern int ti_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
+        'DLLEXPORT extern ti_indicator_info *ti_batch_get_info(ti_batch *batch);',
+        'DLLEXPORT extern int ti_batch_get_progress(ti_batch *batch);',
+        'DLLEXPORT extern int ti_batch_get_nsymbols(ti_batch *batch);',
+        'DLLEXPORT extern void ti_batch_free(ti_batch *batch);',
+        '',
+        '/* A plan evaluates a set of indicators over the same inputs in one cache-blocked pass, */',
+        '/* computing intermediates shared between them (true range, emas, rolling high/low) once. */',
+        '/* Inputs are matched by pointer; outputs are laid out as for the plain functions. */',
+        'typedef struct ti_plan ti_plan;',
+        'DLLEXPORT extern int ti_plan_new(ti_plan **plan);',
+        'DLLEXPORT extern int ti_plan_add(ti_plan *plan, int index, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs);',
+        'DLLEXPORT extern int ti_plan_run(ti_plan *plan, int size);',
+        'DLLEXPORT extern void ti_plan_free(ti_plan *plan);',
         '\n'.join(map(declarations, indicators.items())),
         f'enum {{{", ".join(f"TI_INDICATOR_{name.upper()}_INDEX" for name in sorted(indicators))}}};',
         '#ifdef __cplusplus',
@@ -160,9 +252,35 @@ with open(path_prefix+'indicators_index.c', 'w') as f:
             f'ti_{name}_stream_new' if 'stream' in features else '0',
             f'ti_{name}_stream_run' if 'stream' in features else '0',
             f'ti_{name}_stream_free' if 'stream' in features else '0',
+            f'ti_{name}_batch_new' if 'batch' in features else '0',
+            f'ti_{name}_batch_run' if 'batch' in features else '0',
+            f'ti_{name}_batch_free' if 'batch' in features else '0',
+            f'ti_{name}_multi' if 'multi' in features else '0',
+            f'ti_{name}_range',
+            f'ti_{name}_stream_save' if 'stream' in features else '0',
+            f'ti_{name}_stream_load' if 'stream' in features else '0',
+            f'ti_{name}_stream_clone' if 'stream' in features else '0',
+            f'ti_{name}_stream_clone_into' if 'stream' in features else '0',
+            f'ti_{name}_stream_peek' if 'stream' in features else '0',
         ]) + '}'
         return result
 
+    def range_fallback(indicator):
+        name = indicator[0]
+        return '\n'.join([
+            f'{declaration_range(name)} {{',
+            f'    return ti_range_generic(TI_INDICATOR_{name.upper()}_INDEX, size, inputs, options, first_output, count, outputs);',
+            '}',
+        ])
+
+    def peek_fallback(indicator):
+        name = indicator[0]
+        return '\n'.join([
+            f'{declaration_stream_peek(name)} {{',
+            '    return ti_stream_peek_generic(stream, inputs, outputs);',
+            '}',
+        ])
+
     result = '\n'.join([
         '#include "indicators.h"',
         'const char* ti_version() { return TI_VERSION; }',
@@ -170,7 +288,7 @@ with open(path_prefix+'indicators_index.c', 'w') as f:
         'int ti_indicator_count() { return TI_INDICATOR_COUNT; }',
         '',
         'struct ti_indicator_info ti_indicators[] = {',
-        ',\n'.join(list(map(index_entry, sorted(indicators.items()))) + ['{0,0,0,0,0,0,0,0,0,{0,0},{0,0},{0,0},0,0,0}']),
+        ',\n'.join(list(map(index_entry, sorted(indicators.items()))) + ['{0,0,0,0,0,0,0,0,0,{0,0},{0,0},{0,0},0,0,0,0,0,0,0,0,0,0,0,0,0}']),
         '};'
         '',
         'int ti_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {',
@@ -189,6 +307,114 @@ with open(path_prefix+'indicators_index.c', 'w') as f:
         '    ti_indicators[stream->index].stream_free(stream);',
         '}',
         '',
+        'int ti_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {',
+        '    return ti_indicators[stream->index].stream_peek(stream, inputs, outputs);',
+        '}',
+        '',
+        'enum { ti_stream_header_size = 48, ti_stream_name_size = 32 };',
+        'static const char ti_stream_magic[4] = {\'t\', \'i\', \'s\', \'t\'};',
+        '',
+        'static size_t ti_stream_padded(size_t payload) {',
+        '    return (payload + 7) / 8 * 8;',
+        '}',
+        '',
+        'size_t ti_stream_serialized_size(ti_stream *stream) {',
+        '    return ti_stream_header_size + ti_stream_padded(ti_indicators[stream->index].stream_save(stream, 0));',
+        '}',
+        '',
+        'int ti_stream_save(ti_stream *stream, void *buf) {',
+        '    const ti_indicator_info *info = ti_indicators + stream->index;',
+        '    char *header = (char*)buf;',
+        '    const unsigned int version = TI_STREAM_FORMAT_VERSION;',
+        '    const unsigned long long payload = info->stream_save(stream, header + ti_stream_header_size);',
+        '',
+        '    memcpy(header, ti_stream_magic, 4);',
+        '    memcpy(header + 4, &version, 4);',
+        '    memset(header + 8, 0, ti_stream_name_size);',
+        '    strncpy(header + 8, info->name, ti_stream_name_size - 1);',
+        '    memcpy(header + 8 + ti_stream_name_size, &payload, 8);',
+        '    memset(header + ti_stream_header_size + payload, 0, ti_stream_padded(payload) - payload);',
+        '    return TI_OKAY;',
+        '}',
+        '',
+        'int ti_stream_load(void const *buf, ti_stream **stream) {',
+        '    const char *header = (const char*)buf;',
+        '    unsigned int version;',
+        '    unsigned long long payload;',
+        '    char name[ti_stream_name_size];',
+        '',
+        '    if (memcmp(header, ti_stream_magic, 4) != 0) { return TI_INVALID_OPTION; }',
+        '    memcpy(&version, header + 4, 4);',
+        '    if (version != TI_STREAM_FORMAT_VERSION) { return TI_INVALID_OPTION; }',
+        '    memcpy(name, header + 8, ti_stream_name_size);',
+        '    if (name[ti_stream_name_size - 1] != 0) { return TI_INVALID_OPTION; }',
+        '    memcpy(&payload, header + 8 + ti_stream_name_size, 8);',
+        '',
+        '    const ti_indicator_info *info = ti_find_indicator(name);',
+        '    if (!info || !info->stream_load) { return TI_INVALID_OPTION; }',
+        '    return info->stream_load(header + ti_stream_header_size, (size_t)payload, stream);',
+        '}',
+        '',
+        'int ti_stream_clone(ti_stream const *stream, ti_stream **clone) {',
+        '    return ti_indicators[stream->index].stream_clone(stream, clone);',
+        '}',
+        '',
+        'int ti_stream_clone_into(ti_stream const *stream, ti_stream *clone) {',
+        '    if (clone->index != stream->index) { return TI_INVALID_OPTION; }',
+        '    return ti_indicators[stream->index].stream_clone_into(stream, clone);',
+        '}',
+        '',
+        '/* The fallback for streams without a hand-tuned peek, see utils/peek.cc */',
+        'int ti_stream_peek_generic(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs);',
+        '',
+        '\n'.join(peek_fallback(indicator) for indicator in sorted(indicators.items()) if 'stream' in indicator[1][5] and 'peek' not in indicator[1][5]),
+        '',
+        'int ti_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {',
+        '    return ti_indicators[batch->index].batch_run(batch, inputs, outputs);',
+        '}',
+        '',
+        'ti_indicator_info *ti_batch_get_info(ti_batch *batch) {',
+        '    return ti_indicators + batch->index;',
+        '}',
+        '',
+        'int ti_batch_get_progress(ti_batch *batch) {',
+        '    return batch->progress;',
+        '}',
+        '',
+        'int ti_batch_get_nsymbols(ti_batch *batch) {',
+        '    return batch->nsymbols;',
+        '}',
+        '',
+        'void ti_batch_free(ti_batch *batch) {',
+        '    ti_indicators[batch->index].batch_free(batch);',
+        '}',
+        '',
+        '/* The fallback for indicators without a hand-tuned range: the outputs depend on the past only, */',
+        '/* so the input is cut right after the last requested output and the head of the output is dropped. */',
+        'static int ti_range_generic(int index, int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {',
+        '    const ti_indicator_info *info = ti_indicators + index;',
+        '    if (first_output < 0 || count < 0) { return TI_INVALID_OPTION; }',
+        '    const int start = info->start(options);',
+        '    if (start + first_output + count > size) { return TI_INVALID_OPTION; }',
+        '    if (first_output == 0) { return info->indicator(start + count, inputs, options, outputs); }',
+        '',
+        '    const int outsize = first_output + count;',
+        '    TI_REAL *scratch = (TI_REAL*)malloc(sizeof(TI_REAL) * outsize * info->outputs);',
+        '    if (!scratch) { return TI_OUT_OF_MEMORY; }',
+        '    TI_REAL *full_outputs[TI_MAXINDPARAMS];',
+        '    int j;',
+        '    for (j = 0; j < info->outputs; ++j) { full_outputs[j] = scratch + (size_t)j * outsize; }',
+        '',
+        '    const int ret = info->indicator(start + outsize, inputs, options, full_outputs);',
+        '    if (ret == TI_OKAY) {',
+        '        for (j = 0; j < info->outputs; ++j) { memcpy(outputs[j], full_outputs[j] + first_output, sizeof(TI_REAL) * count); }',
+        '    }',
+        '    free(scratch);',
+        '    return ret;',
+        '}',
+        '',
+        '\n'.join(range_fallback(indicator) for indicator in sorted(indicators.items()) if 'range' not in indicator[1][5]),
+        '',
         'const ti_indicator_info *ti_find_indicator(const char *name) {',
         '    int imin = 0;',
         '    int imax = sizeof(ti_indicators) / sizeof(ti_indicator_info) - 2;',
@@ -273,6 +499,42 @@ for indicator in indicators.items():
         '}',
     ]
 
+    range_ = [
+        '',
+        f'{declaration_range(name)} {{',
+        f'    #error "if the outputs depend on the last ti_{name}_start(options)+1 bars only, use range_window from utils/range.hh"',
+        '',
+        '    #error "otherwise warm up without writing the outputs before first_output"',
+        '',
+        '    return TI_OKAY;',
+        '}',
+    ]
+
+    peek = [
+        '',
+        f'{declaration_stream_peek(name)} {{',
+        f'    #error "compute the outputs for inputs[j][0] as ti_{name}_stream_run would, but keep the state untouched"',
+        '',
+        '    return TI_OKAY;',
+        '}',
+    ]
+
+    multi = [
+        '',
+        f'{declaration_multi(name)} try {{',
+        f'    {unpack_inputs}',
+        f'    const int noptions = {len(options)};',
+        '',
+        '    #error "don\'t forget to validate every row of options"',
+        '',
+        '    #error "share the passes over the input between the option sets"',
+        '',
+        '    return TI_OKAY;',
+        '} catch (std::bad_alloc& e) {',
+        '    return TI_OUT_OF_MEMORY;',
+        '}',
+    ]
+
     stream = [
         '',
         'struct ti_stream {',
@@ -290,13 +552,10 @@ for indicator in indicators.items():
         '    struct {',
         '',
         '    } constants;',
-    ] + ([
         '',
         '    BUFFERS(',
         '',
         '    )',
-    ] if args.old else [
-    ]) + [
         '};',
         '',
         f'{declaration_stream_new(name)} {{',
@@ -304,65 +563,169 @@ for indicator in indicators.items():
         '',
         '    #error "don\'t forget to validate options"',
         '',
-    ] + ([
         '    *stream = calloc(1, sizeof(**stream));',
-    ] if args.old else [
-        '    *stream = new(std::nothrow) ti_stream();',
-    ]) + [
         '    if (!*stream) { return TI_OUT_OF_MEMORY; }',
         '',
         f'    (*stream)->index = TI_INDICATOR_{name.upper()}_INDEX;',
         f'    (*stream)->progress = -ti_{name}_start(options);',
         '',
         '\n'.join(map("    (*stream)->options.{0} = {0};".format, options)),
-    ] + ([
         '',
         '    #error "don\'t forget to initialize buffers"',
         '',
         '    *stream = realloc(*stream, sizeof(**stream) + sizeof(TI_REAL) * BUFFERS_SIZE(*stream));',
         '    if (!stream) { return TI_OUT_OF_MEMORY; }',
+        '',
+        '    return TI_OKAY;',
+        '}',
+        '',
+        f'{declaration_stream_free(name)} {{',
+        '    free(stream);',
+        '}',
+        '',
+        f'{declaration_stream_run(name)} {{',
+        f'    {unpack_inputs}',
+        f'    {unpack_outputs}',
+        '    int progress = stream->progress;',
+        '\n'.join(map("    const TI_REAL {0} = stream->options.{0};".format, options)),
+        '',
+        '    int i = 0;',
+        '    #error "streaming implementation goes here"',
+        '',
+        '    stream->progress = progress;',
+        '    #error "be sure to save all the state"',
+        '',
+        '    return TI_OKAY;',
+        '}',
     ] if args.old else [
+        '',
+        f'struct ti_{name}_stream : stream_base {{',
+        '    struct {',
+        f'        {(nl+" "*8).join(map("TI_REAL {};".format, options))}',
+        '    } options;',
+        '',
+        '    struct {',
+        '',
+        '    } state;',
+        '',
+        '    struct {',
+        '',
+        '    } constants;',
+        '};',
+        '',
+        f'{declaration_stream_new(name)} {{',
+        f'    {unpack_options}',
+        '',
+        '    #error "don\'t forget to validate options"',
+        '',
+        f'    ti_{name}_stream *ptr = new(std::nothrow) ti_{name}_stream();',
+        '    if (!ptr) { return TI_OUT_OF_MEMORY; }',
+        '    *stream = ptr;',
+        '',
+        f'    ptr->index = TI_INDICATOR_{name.upper()}_INDEX;',
+        f'    ptr->progress = -ti_{name}_start(options);',
+        '    ptr->keep_options(options);',
+        '',
+        '\n'.join(map("    ptr->options.{0} = {0};".format, options)),
         '',
         '    try {',
         '        #error "don\'t forget to initialize ringbuffers and any other storage"',
         '    } catch (std::bad_alloc& e) {',
-        '        delete *stream;',
+        '        delete ptr;',
         '        return TI_OUT_OF_MEMORY;',
         '    }',
-    ]) + [
         '',
         '    return TI_OKAY;',
         '}',
         '',
         f'{declaration_stream_free(name)} {{',
-    ] + ([
-        '    free(stream);',
-    ] if args.old else [
-        '    delete stream;',
-    ]) + [
+        f'    delete static_cast<ti_{name}_stream*>(stream);',
         '}',
         '',
+        '#error "list the mutable state for save/load, the options and constants are restored by stream_new; #include \"../utils/stream.hh\""',
+        f'STREAM_IO({name}, s.state)',
+        '',
         f'{declaration_stream_run(name)} {{',
+        f'    ti_{name}_stream *ptr = static_cast<ti_{name}_stream*>(stream);',
         f'    {unpack_inputs}',
         f'    {unpack_outputs}',
-        '    int progress = stream->progress;',
-        '\n'.join(map("    const TI_REAL {0} = stream->options.{0};".format, options)),
+        '    int progress = ptr->progress;',
+        '\n'.join(map("    const TI_REAL {0} = ptr->options.{0};".format, options)),
         '',
         '    int i = 0;',
         '    #error "streaming implementation goes here"',
         '',
-        '    stream->progress = progress;',
+        '    ptr->progress = progress;',
         '    #error "be sure to save all the state"',
         '',
         '    return TI_OKAY;',
         '}',
     ]
 
+    batch = [
+        '',
+        f'struct ti_{name}_batch : ti_batch {{',
+        '    struct {',
+        f'        {(nl+" "*8).join(map("TI_REAL {};".format, options))}',
+        '    } options;',
+        '',
+        '    struct {',
+        '        /* one std::vector<TI_REAL> of nsymbols elements per state variable */',
+        '    } state;',
+        '',
+        '    struct {',
+        '',
+        '    } constants;',
+        '};',
+        '',
+        f'{declaration_batch_new(name)} {{',
+        f'    {unpack_options}',
+        '',
+        '    #error "don\'t forget to validate options"',
+        '    if (nsymbols < 1) { return TI_INVALID_OPTION; }',
+        '',
+        f'    ti_{name}_batch *ptr = new(std::nothrow) ti_{name}_batch();',
+        '    if (!ptr) { return TI_OUT_OF_MEMORY; }',
+        '    *batch = ptr;',
+        '',
+        f'    ptr->index = TI_INDICATOR_{name.upper()}_INDEX;',
+        f'    ptr->progress = -ti_{name}_start(options);',
+        '    ptr->nsymbols = nsymbols;',
+        '',
+        '\n'.join(map("    ptr->options.{0} = {0};".format, options)),
+        '',
+        '    try {',
+        '        #error "don\'t forget to size the per-symbol state"',
+        '    } catch (std::bad_alloc& e) {',
+        '        delete ptr;',
+        '        return TI_OUT_OF_MEMORY;',
+        '    }',
+        '',
+        '    return TI_OKAY;',
+        '}',
+        '',
+        f'{declaration_batch_free(name)} {{',
+        f'    delete static_cast<ti_{name}_batch*>(batch);',
+        '}',
+        '',
+        f'{declaration_batch_run(name)} {{',
+        f'    ti_{name}_batch *ptr = static_cast<ti_{name}_batch*>(batch);',
+        '    const int nsymbols = ptr->nsymbols;',
+        '    int progress = ptr->progress;',
+        '',
+        '    #error "advance every symbol by one bar, keep the inner loop over symbols branchless"',
+        '',
+        '    ptr->progress = progress + 1;',
+        '',
+        '    return TI_OKAY;',
+        '}',
+    ]
+
     path = file_path_c if args.old else file_path_cc
     if not os.path.exists(file_path_c) and not os.path.exists(file_path_cc):
         with open(path, 'w') as f:
             print(f'codegen.py: indicators/{os.path.basename(path)}')
-            parts = includes + base + (ref if 'ref' in features else []) + (stream if 'stream' in features else [])
+            parts = includes + base + (ref if 'ref' in features else []) + (range_ if 'range' in features else []) + (multi if 'multi' in features else []) + (stream if 'stream' in features else []) + (peek if 'peek' in features else []) + (batch if 'batch' in features else [])
             f.write('\n'.join(parts))
             os.system(f'git add -N {path}')
     else:
@@ -375,9 +738,17 @@ for indicator in indicators.items():
 
         should_add_ref = 'ref' in features and not re.search(f'ti_{name}_ref', contents)
         should_add_stream = 'stream' in features and not re.search(f'ti_{name}_stream', contents)
+        should_add_batch = 'batch' in features and not re.search(f'ti_{name}_batch', contents)
+        should_add_multi = 'multi' in features and not re.search(f'ti_{name}_multi', contents)
+        should_add_range = 'range' in features and not re.search(f'ti_{name}_range', contents)
+        should_add_peek = 'peek' in features and not re.search(f'ti_{name}_stream_peek', contents)
         tbd = (
             (ref if should_add_ref else []) +
-            (stream if should_add_stream else [])
+            (range_ if should_add_range else []) +
+            (multi if should_add_multi else []) +
+            (stream if should_add_stream else []) +
+            (peek if should_add_peek else []) +
+            (batch if should_add_batch else [])
         )
 
     if tbd:
@@ -417,6 +788,6 @@ for indicator in indicators.items():
         with open(path, 'r') as f:
             lines = f.readlines()
         with open(path, 'a') as f:
-            print(f'codegen.py: adding{" ref" if should_add_ref else ""}{" stream" if should_add_stream else ""} to indicators/{os.path.basename(path)}')
+            print(f'codegen.py: adding{" ref" if should_add_ref else ""}{" range" if should_add_range else ""}{" multi" if should_add_multi else ""}{" stream" if should_add_stream else ""}{" peek" if should_add_peek else ""}{" batch" if should_add_batch else ""} to indicators/{os.path.basename(path)}')
             f.write('\n'.join(['']+tbd))
             os.system(f'git add {path}')
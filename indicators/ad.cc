@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_ad_start(TI_REAL const *options) {
@@ -35,3 +38,55 @@ int ti_ad(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
 
     return TI_OKAY;
 }
+
+
+struct ti_ad_stream : stream_base {
+    struct {
+        TI_REAL sum;
+    } state;
+};
+
+
+int ti_ad_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_ad_stream *ptr = new(std::nothrow) ti_ad_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_AD_INDEX;
+    ptr->progress = -ti_ad_start(options);
+    ptr->keep_options(options);
+
+    return TI_OKAY;
+}
+
+void ti_ad_stream_free(ti_stream *stream) {
+    delete static_cast<ti_ad_stream*>(stream);
+}
+
+STREAM_IO(ad, s.state)
+
+int ti_ad_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ad_stream *ptr = static_cast<ti_ad_stream*>(stream);
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    const TI_REAL *volume = inputs[3];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL sum = ptr->state.sum;
+
+    int i;
+    for (i = 0; i < size; ++i) {
+        const TI_REAL hl = (high[i] - low[i]);
+        if (hl != 0.0) {
+            sum += (close[i] - low[i] - high[i] + close[i]) / hl * volume[i];
+        }
+        output[i] = sum;
+    }
+
+    ptr->progress += size;
+    ptr->state.sum = sum;
+
+    return TI_OKAY;
+}
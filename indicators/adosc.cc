@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_adosc_start(TI_REAL const *options) {
@@ -58,3 +61,99 @@ int ti_adosc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     return TI_OKAY;
 }
 
+
+
+struct ti_adosc_stream : stream_base {
+    struct {
+        int short_period;
+        int long_period;
+    } options;
+
+    struct {
+        TI_REAL sum;
+        TI_REAL short_ema;
+        TI_REAL long_ema;
+    } state;
+
+    struct {
+        TI_REAL short_per;
+        TI_REAL long_per;
+    } constants;
+};
+
+
+int ti_adosc_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int long_period = (int)options[1];
+
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (long_period < short_period) return TI_INVALID_OPTION;
+
+    ti_adosc_stream *ptr = new(std::nothrow) ti_adosc_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_ADOSC_INDEX;
+    ptr->progress = -ti_adosc_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.long_period = long_period;
+
+    ptr->constants.short_per = 2 / ((TI_REAL)short_period + 1);
+    ptr->constants.long_per = 2 / ((TI_REAL)long_period + 1);
+
+    return TI_OKAY;
+}
+
+void ti_adosc_stream_free(ti_stream *stream) {
+    delete static_cast<ti_adosc_stream*>(stream);
+}
+
+STREAM_IO(adosc, s.state)
+
+int ti_adosc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_adosc_stream *ptr = static_cast<ti_adosc_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    const TI_REAL *volume = inputs[3];
+    TI_REAL *output = outputs[0];
+
+    const int start = ptr->options.long_period - 1;
+    const TI_REAL short_per = ptr->constants.short_per;
+    const TI_REAL long_per = ptr->constants.long_per;
+
+    TI_REAL sum = ptr->state.sum;
+    TI_REAL short_ema = ptr->state.short_ema;
+    TI_REAL long_ema = ptr->state.long_ema;
+
+    int i;
+    for (i = 0; i < size; ++i, ++progress) {
+        const TI_REAL hl = (high[i] - low[i]);
+        if (hl != 0.0) {
+            sum += (close[i] - low[i] - high[i] + close[i]) / hl * volume[i];
+        }
+
+        if (progress == -start) {
+            short_ema = sum;
+            long_ema = sum;
+        } else {
+            short_ema = (sum-short_ema) * short_per + short_ema;
+            long_ema = (sum-long_ema) * long_per + long_ema;
+        }
+
+        if (progress >= 0) {
+            *output++ = short_ema - long_ema;
+        }
+    }
+
+    ptr->progress = progress;
+    ptr->state.sum = sum;
+    ptr->state.short_ema = short_ema;
+    ptr->state.long_ema = long_ema;
+
+    return TI_OKAY;
+}
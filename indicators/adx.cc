@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "dx.h"
+#include "../utils/stream.hh"
 
 int ti_adx_start(TI_REAL const *options) {
     return ((int)options[0]-1) * 2;
@@ -88,3 +89,92 @@ int ti_adx(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_adx_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_adx_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        dm_state dm;
+        TI_REAL adx;
+    } state;
+
+    struct {
+        TI_REAL per;
+        TI_REAL invper;
+    } constants;
+};
+
+
+int ti_adx_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 2) return TI_INVALID_OPTION;
+
+    ti_adx_stream *ptr = new(std::nothrow) ti_adx_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_ADX_INDEX;
+    ptr->progress = -ti_adx_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = ((TI_REAL)period-1) / ((TI_REAL)period);
+    ptr->constants.invper = 1.0 / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_adx_stream_free(ti_stream *stream) {
+    delete static_cast<ti_adx_stream*>(stream);
+}
+
+STREAM_IO(adx, s.state)
+
+int ti_adx_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_adx_stream *ptr = static_cast<ti_adx_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL invper = ptr->constants.invper;
+
+    dm_state dm = ptr->state.dm;
+    TI_REAL adx = ptr->state.adx;
+
+    /* the bar index of the batch loop is progress + (period-1) * 2:
+       the moves are summed up to the bar period-1, the dx up to the first output */
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress) {
+        const int bar = progress + (period-1) * 2;
+        if (bar == 0) {
+            dm.first(high[i], low[i]);
+            continue;
+        }
+        dm.update(high[i], low[i], bar < period ? 1 : per);
+        if (bar >= period-1) {
+            adx += dm.dx();
+        }
+        if (progress == 0) {
+            *output++ = adx * invper;
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        dm.update(high[i], low[i], per);
+        adx = adx * per + dm.dx();
+        *output++ = adx * invper;
+    }
+
+    ptr->progress = progress;
+    ptr->state.dm = dm;
+    ptr->state.adx = adx;
+
+    return TI_OKAY;
+}
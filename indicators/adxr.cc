@@ -10,6 +10,8 @@
 #include "../indicators.h"
 #include "dx.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_adxr_start(TI_REAL const *options) {
@@ -100,3 +102,107 @@ int ti_adxr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(output - outputs[0] == size - ti_adxr_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_adxr_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        dm_state dm;
+        TI_REAL adx;
+        ringbuf<0> adxs; /* the last period-1 values of adx */
+    } state;
+
+    struct {
+        TI_REAL per;
+        TI_REAL invper;
+    } constants;
+};
+
+
+int ti_adxr_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 2) return TI_INVALID_OPTION;
+
+    ti_adxr_stream *ptr = new(std::nothrow) ti_adxr_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_ADXR_INDEX;
+    ptr->progress = -ti_adxr_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = ((TI_REAL)period-1) / ((TI_REAL)period);
+    ptr->constants.invper = 1.0 / ((TI_REAL)period);
+
+    try {
+        ptr->state.adxs.resize(period-1);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_adxr_stream_free(ti_stream *stream) {
+    delete static_cast<ti_adxr_stream*>(stream);
+}
+
+STREAM_IO(adxr, s.state.dm, s.state.adx, s.state.adxs)
+
+int ti_adxr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_adxr_stream *ptr = static_cast<ti_adxr_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL invper = ptr->constants.invper;
+
+    dm_state dm = ptr->state.dm;
+    TI_REAL adx = ptr->state.adx;
+    auto &adxs = ptr->state.adxs;
+
+    /* the bar index of the batch loop is progress + (period-1) * 3:
+       the moves are summed up to the bar period-1, the dx up to the bar (period-1) * 2 */
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        const int bar = progress + (period-1) * 3;
+        if (bar == 0) {
+            dm.first(high[i], low[i]);
+            continue;
+        }
+        dm.update(high[i], low[i], bar < period ? 1 : per);
+        if (bar >= period-1) {
+            adx = adx * (bar <= (period-1) * 2 ? 1 : per) + dm.dx();
+        }
+        if (bar >= (period-1) * 2) {
+            adxs = adx * invper;
+            step(adxs);
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        dm.update(high[i], low[i], per);
+        adx = adx * per + dm.dx();
+
+        /* before the assignment, the ring holds the adx of period-1 bars ago */
+        *output++ = 0.5 * (adx * invper + adxs);
+
+        adxs = adx * invper;
+        step(adxs);
+    }
+
+    ptr->progress = progress;
+    ptr->state.dm = dm;
+    ptr->state.adx = adx;
+
+    return TI_OKAY;
+}
@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_ahma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -51,7 +52,7 @@ DONTOPTIMIZE int ti_ahma_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_ahma_stream : ti_stream {
+struct ti_ahma_stream : stream_base {
 
     struct {
         int period;
@@ -77,6 +78,7 @@ int ti_ahma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_AHMA_INDEX;
     ptr->progress = -ti_ahma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -89,6 +91,8 @@ void ti_ahma_stream_free(ti_stream *stream) {
     delete static_cast<ti_ahma_stream*>(stream);
 }
 
+STREAM_IO(ahma, s.state.filt)
+
 int ti_ahma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_ahma_stream *ptr = static_cast<ti_ahma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_aroon_start(TI_REAL const *options) {
@@ -80,3 +84,90 @@ int ti_aroon(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     assert(aup - outputs[1] == size - ti_aroon_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_aroon_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        ringbuf_minmax<0> price_high;
+        ringbuf_minmax<0> price_low;
+    } state;
+
+    struct {
+        TI_REAL scale;
+    } constants;
+};
+
+
+int ti_aroon_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_aroon_stream *ptr = new(std::nothrow) ti_aroon_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_AROON_INDEX;
+    ptr->progress = -ti_aroon_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.scale = 100.0 / period;
+
+    /* the window is period+1 bars long, the newest extremum wins the ties */
+    try {
+        ptr->state.price_high.resize(period+1);
+        ptr->state.price_low.resize(period+1);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_aroon_stream_free(ti_stream *stream) {
+    delete static_cast<ti_aroon_stream*>(stream);
+}
+
+STREAM_IO(aroon, s.state.price_high, s.state.price_low)
+
+int ti_aroon_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_aroon_stream *ptr = static_cast<ti_aroon_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *adown = outputs[0];
+    TI_REAL *aup = outputs[1];
+
+    const int period = ptr->options.period;
+    const TI_REAL scale = ptr->constants.scale;
+
+    auto &price_high = ptr->state.price_high;
+    auto &price_low = ptr->state.price_low;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price_high, price_low)) {
+        price_high = high[i];
+        price_low = low[i];
+    }
+    for (; i < size; ++i, ++progress, step(price_high, price_low)) {
+        price_high = high[i];
+        price_low = low[i];
+
+        const int maxage = price_high.iterator_to_age(price_high.find_max(period+1));
+        const int minage = price_low.iterator_to_age(price_low.find_min(period+1));
+
+        *adown++ = ((TI_REAL)period - minage) * scale;
+        *aup++ = ((TI_REAL)period - maxage) * scale;
+    }
+
+    ptr->progress = progress;
+
+    return TI_OKAY;
+}
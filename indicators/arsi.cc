@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_arsi_start(TI_REAL const *options) {
     const TI_REAL cycpart = options[0];
@@ -136,7 +137,7 @@ DONTOPTIMIZE int ti_arsi_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_arsi_stream : ti_stream {
+struct ti_arsi_stream : stream_base {
 
     struct {
         TI_REAL cycpart;
@@ -172,6 +173,7 @@ int ti_arsi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_ARSI_INDEX;
     ptr->progress = -ti_arsi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.cycpart = cycpart;
 
@@ -184,6 +186,10 @@ void ti_arsi_stream_free(ti_stream *stream) {
     delete static_cast<ti_arsi_stream*>(stream);
 }
 
+STREAM_IO(arsi,
+    s.state.Smooth, s.state.Detrender, s.state.I1, s.state.Q1, s.state.I2, s.state.Q2, s.state.Re,
+    s.state.Im, s.state.Period, s.state.SmoothPeriod, s.state.Price)
+
 int ti_arsi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_arsi_stream *ptr = static_cast<ti_arsi_stream*>(stream);
     TI_REAL const *const series = inputs[0];
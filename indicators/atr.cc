@@ -6,10 +6,15 @@
 
 
 #include <new>
+#include <vector>
+#include <algorithm>
 
 #include "../indicators.h"
 #include "truerange.h"
 #include "../utils/minmax.h"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
+#include "../utils/stream.hh"
 
 
 
@@ -58,6 +63,104 @@ int ti_atr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
 }
 
 
+int ti_atr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+
+    const int period = (int)options[0];
+
+    TI_REAL *output = outputs[0];
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (!range_check(size, ti_atr_start(options), first_output, count)) return TI_INVALID_OPTION;
+    if (count == 0) return TI_OKAY;
+
+    const TI_REAL per = 1.0 / ((TI_REAL)period);
+
+    TI_REAL sum = 0;
+    TI_REAL truerange;
+
+    sum += high[0] - low[0];
+    int i;
+    for (i = 1; i < period; ++i) {
+        CALC_TRUERANGE();
+        sum += truerange;
+    }
+
+    TI_REAL val = sum / period;
+
+    const int first = period-1 + first_output;
+    for (; i <= first; ++i) {
+        CALC_TRUERANGE();
+        val = (truerange-val) * per + val;
+    }
+    *output++ = val;
+
+    for (; i < first + count; ++i) {
+        CALC_TRUERANGE();
+        val = (truerange-val) * per + val;
+        *output++ = val;
+    }
+
+    assert(output - outputs[0] == count);
+    return TI_OKAY;
+}
+
+int ti_atr_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    /* The true range is shared by all periods, its prefix sums give the initial averages. */
+    std::vector<TI_REAL> tr(size);
+    tr[0] = high[0] - low[0];
+    for (int i = 1; i < size; ++i) {
+        TI_REAL truerange;
+        CALC_TRUERANGE();
+        tr[i] = truerange;
+    }
+    std::vector<TI_REAL> tr_sum(size+1);
+    prefix_sum(size, tr.data(), 0, tr_sum.data(), [](int, TI_REAL x) { return x; });
+
+    std::vector<TI_REAL> val(nparams);
+
+    for (int tile = 0; tile < size; tile += multi_tile) {
+        const int tile_end = MIN(size, tile + multi_tile);
+
+        for (int p = 0; p < nparams; ++p) {
+            const int period = (int)multi_options(options, 1, p)[0];
+            const TI_REAL per = 1.0 / ((TI_REAL)period);
+            TI_REAL *output = multi_output(outputs, 0, size, p);
+
+            int i = MAX(tile, period-1);
+            if (i >= tile_end) { continue; }
+
+            TI_REAL v = val[p];
+            if (i == period-1) {
+                v = tr_sum[period] / period;
+                output[i-(period-1)] = v;
+                ++i;
+            }
+            for (; i < tile_end; ++i) {
+                v = (tr[i]-v) * per + v;
+                output[i-(period-1)] = v;
+            }
+            val[p] = v;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
 int ti_atr_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
 
     //atr = ti_wilders(ti_tr)
@@ -89,7 +192,7 @@ int ti_atr_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
 }
 
 
-struct ti_atr_stream : ti_stream {
+struct ti_atr_stream : stream_base {
     /* required */
 
     /* indicator specific */
@@ -110,6 +213,7 @@ int ti_atr_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_ATR_INDEX;
     ptr->progress = -ti_atr_start(options);
+    ptr->keep_options(options);
     ptr->period = period;
     ptr->sum = 0.0;
 
@@ -119,16 +223,6 @@ int ti_atr_stream_new(TI_REAL const *options, ti_stream **stream) {
 int ti_atr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_atr_stream *ptr = static_cast<ti_atr_stream*>(stream);
 
-    #undef CALC_TRUERANGE
-    #define CALC_TRUERANGE(var, h, l, c) do { \
-        const TI_REAL ych = fabs((h) - (c)); \
-        const TI_REAL ycl = fabs((l) - (c)); \
-        TI_REAL v = (h) - (l); \
-        if (ych > v) v = ych; \
-        if (ycl > v) v = ycl; \
-        var = v; \
-    } while (0)
-
     const TI_REAL *high = inputs[0];
     const TI_REAL *low = inputs[1];
     const TI_REAL *close = inputs[2];
@@ -151,7 +245,7 @@ int ti_atr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
         /* still calculating first output */
         while (ptr->progress <= 0 && i < size) {
-            TI_REAL truerange; CALC_TRUERANGE(truerange, high[i], low[i], ptr->last_close);
+            const TI_REAL truerange = truerange_of(high[i], low[i], ptr->last_close);
             ptr->sum += truerange;
             ptr->last_close = close[i];
             ++ptr->progress; ++i;
@@ -168,7 +262,7 @@ int ti_atr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
         /* steady state */
         TI_REAL val = ptr->last;
         while (i < size) {
-            TI_REAL truerange; CALC_TRUERANGE(truerange, high[i], low[i], ptr->last_close);
+            const TI_REAL truerange = truerange_of(high[i], low[i], ptr->last_close);
             val = (truerange-val) * per + val;
             *output++ = val;
             ptr->last_close = close[i];
@@ -181,7 +275,125 @@ int ti_atr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
     return TI_OKAY;
 }
 
+int ti_atr_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_atr_stream const *ptr = static_cast<ti_atr_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL high = inputs[0][0];
+    const TI_REAL low = inputs[1][0];
+    const TI_REAL per = 1.0 / ((TI_REAL)ptr->period);
+
+    if (ptr->progress == 0 && ptr->period == 1) {
+        outputs[0][0] = (high - low) * per;
+    } else {
+        const TI_REAL truerange = truerange_of(high, low, ptr->last_close);
+        if (ptr->progress == 0) {
+            outputs[0][0] = (ptr->sum + truerange) * per;
+        } else {
+            outputs[0][0] = (truerange - ptr->last) * per + ptr->last;
+        }
+    }
+
+    return TI_OKAY;
+}
+
 
 void ti_atr_stream_free(ti_stream *stream) {
     delete static_cast<ti_atr_stream*>(stream);
 }
+
+STREAM_IO(atr, s.sum, s.last, s.last_close)
+
+
+struct ti_atr_batch : ti_batch {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        std::vector<TI_REAL> val; /* running sum while warming up, then the smoothed value */
+        std::vector<TI_REAL> last_close;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_atr_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+    if (nsymbols < 1) return TI_INVALID_OPTION;
+
+    ti_atr_batch *ptr = new(std::nothrow) ti_atr_batch();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *batch = ptr;
+
+    ptr->index = TI_INDICATOR_ATR_INDEX;
+    ptr->progress = -ti_atr_start(options);
+    ptr->nsymbols = nsymbols;
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 1. / period;
+
+    try {
+        ptr->state.val.resize(nsymbols);
+        ptr->state.last_close.resize(nsymbols);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_atr_batch_free(ti_batch *batch) {
+    delete static_cast<ti_atr_batch*>(batch);
+}
+
+int ti_atr_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_atr_batch *ptr = static_cast<ti_atr_batch*>(batch);
+    const int nsymbols = ptr->nsymbols;
+    const int progress = ptr->progress;
+
+    TI_REAL const *const high = inputs[0];
+    TI_REAL const *const low = inputs[1];
+    TI_REAL const *const close = inputs[2];
+    TI_REAL *const atr = outputs[0];
+
+    const int start = -(ptr->options.period-1);
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL *const val = ptr->state.val.data();
+    TI_REAL *const last_close = ptr->state.last_close.data();
+
+    if (progress == start) {
+        for (int s = 0; s < nsymbols; ++s) {
+            val[s] = high[s] - low[s];
+        }
+    } else if (progress <= 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            val[s] += truerange_of(high[s], low[s], last_close[s]);
+        }
+    } else {
+        for (int s = 0; s < nsymbols; ++s) {
+            val[s] = (truerange_of(high[s], low[s], last_close[s]) - val[s]) * per + val[s];
+        }
+    }
+
+    if (progress == 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            val[s] *= per;
+        }
+    }
+    if (progress >= 0) {
+        std::copy(val, val + nsymbols, atr);
+    }
+    std::copy(close, close + nsymbols, last_close);
+
+    ptr->progress = progress + 1;
+
+    return TI_OKAY;
+}
@@ -6,6 +6,7 @@
 
 
 #include "../indicators.h"
+#include "../utils/dispatch.h"
 
 
 int ti_avgprice_start(TI_REAL const *options) {
@@ -14,6 +15,7 @@ int ti_avgprice_start(TI_REAL const *options) {
 }
 
 
+TI_DISPATCH
 int ti_avgprice(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *open = inputs[0];
     const TI_REAL *high = inputs[1];
@@ -24,6 +26,7 @@ int ti_avgprice(int size, TI_REAL const *const *inputs, TI_REAL const *options,
 
     TI_REAL *output = outputs[0];
     int i;
+    TI_SIMD
     for (i = 0; i < size; ++i) {
         output[i] = (open[i] + high[i] + low[i] + close[i]) * 0.25;
     }
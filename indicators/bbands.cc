@@ -5,7 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/moments.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_bbands_start(TI_REAL const *options) {
@@ -61,3 +66,103 @@ int ti_bbands(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     assert(upper - outputs[2] == size - ti_bbands_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_bbands_stream : stream_base {
+    struct {
+        int period;
+        TI_REAL stddev;
+    } options;
+
+    struct {
+        rolling_moments moments;
+        int refresh;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        TI_REAL scale;
+    } constants;
+};
+
+
+int ti_bbands_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    const TI_REAL stddev = options[1];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_bbands_stream *ptr = new(std::nothrow) ti_bbands_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_BBANDS_INDEX;
+    ptr->progress = -ti_bbands_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+    ptr->options.stddev = stddev;
+
+    ptr->state.refresh = 1; /* the first full window */
+
+    ptr->constants.scale = 1.0 / period;
+
+    try {
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_bbands_stream_free(ti_stream *stream) {
+    delete static_cast<ti_bbands_stream*>(stream);
+}
+
+STREAM_IO(bbands, s.state.moments, s.state.refresh, s.state.price)
+
+int ti_bbands_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_bbands_stream *ptr = static_cast<ti_bbands_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *lower = outputs[0];
+    TI_REAL *middle = outputs[1];
+    TI_REAL *upper = outputs[2];
+
+    const int period = ptr->options.period;
+    const TI_REAL stddev = ptr->options.stddev;
+    const TI_REAL scale = ptr->constants.scale;
+
+    rolling_moments moments = ptr->state.moments;
+    int refresh = ptr->state.refresh;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = input[i];
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
+        price = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(price, period, scale);
+        } else {
+            moments.slide(price, oldest, scale);
+        }
+
+        const TI_REAL sd = sqrt(moments.var(scale));
+        *lower++ = moments.mean - stddev * sd;
+        *middle++ = moments.mean;
+        *upper++ = moments.mean + stddev * sd;
+    }
+
+    ptr->progress = progress;
+    ptr->state.moments = moments;
+    ptr->state.refresh = refresh;
+
+    return TI_OKAY;
+}
@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_bf2_start(TI_REAL const *options) {
     TI_REAL period = options[0];
@@ -64,7 +65,7 @@ int ti_bf2(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     return TI_OKAY;
 }
 
-struct ti_bf2_stream : ti_stream {
+struct ti_bf2_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -99,6 +100,7 @@ int ti_bf2_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_BF2_INDEX;
     ptr->progress = -ti_bf2_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -115,6 +117,8 @@ void ti_bf2_stream_free(ti_stream *stream) {
     delete static_cast<ti_bf2_stream*>(stream);
 }
 
+STREAM_IO(bf2, s.state)
+
 int ti_bf2_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_bf2_stream *ptr = static_cast<ti_bf2_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_bf3_start(TI_REAL const *options) {
     TI_REAL period = options[0];
@@ -70,7 +71,7 @@ int ti_bf3(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     return TI_OKAY;
 }
 
-struct ti_bf3_stream : ti_stream {
+struct ti_bf3_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -109,6 +110,7 @@ int ti_bf3_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_BF3_INDEX;
     ptr->progress = -ti_bf3_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -127,6 +129,8 @@ void ti_bf3_stream_free(ti_stream *stream) {
     delete static_cast<ti_bf3_stream*>(stream);
 }
 
+STREAM_IO(bf3, s.state)
+
 int ti_bf3_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_bf3_stream *ptr = static_cast<ti_bf3_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -9,6 +9,9 @@
 
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 
 
 #define TYPPRICE(INDEX) ((high[(INDEX)] + low[(INDEX)] + close[(INDEX)]) * (1.0/3.0))
@@ -20,7 +23,76 @@ int ti_cci_start(TI_REAL const *options) {
 }
 
 
-int ti_cci(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* below it the direct loop is faster, see md.cc */
+static const int tree_period = 1000;
+
+
+static TI_REAL cci_value(orderstat const &window, TI_REAL today, TI_REAL scale) {
+    const TI_REAL avg = window.sum() * scale;
+    TI_REAL cci = window.sum_deviation(avg) * scale;
+    cci *= .015;
+    if (cci) { cci = (today-avg)/cci; }
+    return cci;
+}
+
+
+int ti_cci(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+
+    const int period = (int)options[0];
+
+    const TI_REAL scale = 1.0 / period;
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (size <= ti_cci_start(options)) return TI_OKAY;
+
+    TI_REAL *output = outputs[0];
+
+    if (period < tree_period) {
+        ti_buffer *sum = ti_buffer_new(period);
+
+        int i;
+        for (i = 0; i < size; ++i) {
+            const TI_REAL today = TYPPRICE(i);
+            ti_buffer_push(sum, today);
+            const TI_REAL avg = sum->sum * scale;
+
+            if (i >= period * 2 - 2) {
+                TI_REAL cci = sum_deviation(sum->vals, period, avg) * scale;
+                cci *= .015;
+                if (cci) { cci = (today-avg)/cci; }
+                *output++ = cci;
+            }
+        }
+
+        ti_buffer_free(sum);
+    } else {
+        orderstat window(period);
+        ringbuf<0> price(period);
+
+        int progress = -ti_cci_start(options);
+
+        for (int i = 0; i < size; ++i, ++progress, step(price)) {
+            const TI_REAL today = TYPPRICE(i);
+            price = today;
+            window.insert(today);
+
+            if (progress >= 0) { *output++ = cci_value(window, today, scale); }
+
+            if (window.size() == period) { window.erase(price[period-1]); }
+        }
+    }
+
+    assert(output - outputs[0] == size - ti_cci_start(options));
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+int ti_cci_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *high = inputs[0];
     const TI_REAL *low = inputs[1];
     const TI_REAL *close = inputs[2];
@@ -60,3 +132,104 @@ int ti_cci(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_cci_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_cci_stream : stream_base {
+
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL sum; /* of the last period-1 values, below tree_period */
+        orderstat window; /* from tree_period up */
+        ringbuf<0> price;
+    } state;
+};
+
+int ti_cci_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+
+    if (period < 1) { return TI_INVALID_OPTION; }
+
+    ti_cci_stream *ptr = new(std::nothrow) ti_cci_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_CCI_INDEX;
+    ptr->progress = -ti_cci_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        if (period >= tree_period) { ptr->state.window.reserve(period); }
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_cci_stream_free(ti_stream *stream) {
+    delete static_cast<ti_cci_stream*>(stream);
+}
+
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_cci_stream &s) {
+    if (s.options.period >= tree_period) {
+        orderstat_refill(s.state.window, s.state.price, s.progress + (s.options.period-1) * 2);
+    }
+}
+
+STREAM_IO(cci, s.state.sum, s.state.price)
+
+int ti_cci_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_cci_stream *ptr = static_cast<ti_cci_stream*>(stream);
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *output = outputs[0];
+    int progress = ptr->progress;
+    const int period = ptr->options.period;
+    const TI_REAL scale = 1.0 / period;
+    auto &window = ptr->state.window;
+    auto &price = ptr->state.price;
+
+    if (period < tree_period) {
+        /* the ring holds the window, in whatever order, and zeros until it fills up */
+        TI_REAL sum = ptr->state.sum;
+        for (int i = 0; i < size; ++i, ++progress, step(price)) {
+            const TI_REAL today = TYPPRICE(i);
+            price = today;
+            sum += today;
+
+            if (progress >= 0) {
+                const TI_REAL avg = sum * scale;
+                TI_REAL cci = sum_deviation(price.phbegin(), period, avg) * scale;
+                cci *= .015;
+                if (cci) { cci = (today-avg)/cci; }
+                *output++ = cci;
+            }
+
+            sum -= price[period-1];
+        }
+        ptr->state.sum = sum;
+    } else {
+        for (int i = 0; i < size; ++i, ++progress, step(price)) {
+            const TI_REAL today = TYPPRICE(i);
+            price = today;
+            window.insert(today);
+
+            if (progress >= 0) { *output++ = cci_value(window, today, scale); }
+
+            if (window.size() == period) { window.erase(price[period-1]); }
+        }
+    }
+
+    ptr->progress = progress;
+
+    return TI_OKAY;
+}
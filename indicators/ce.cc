@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_ce_start(TI_REAL const *options) {
@@ -147,7 +148,7 @@ int ti_ce_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     return TI_OKAY;
 }
 
-struct ti_ce_stream : ti_stream {
+struct ti_ce_stream : stream_base {
     struct {
         int period;
         TI_REAL coef;
@@ -162,8 +163,8 @@ struct ti_ce_stream : ti_stream {
         TI_REAL atr;
         TI_REAL prev_close;
 
-        ringbuf<0> price_high;
-        ringbuf<0> price_low;
+        ringbuf_minmax<0> price_high;
+        ringbuf_minmax<0> price_low;
     } state;
 
     struct {
@@ -183,6 +184,7 @@ int ti_ce_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_CE_INDEX;
     ptr->progress = -ti_ce_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.coef = coef;
@@ -205,6 +207,10 @@ void ti_ce_stream_free(ti_stream *stream) {
     delete static_cast<ti_ce_stream*>(stream);
 }
 
+STREAM_IO(ce,
+    s.state.max, s.state.min, s.state.max_idx, s.state.min_idx, s.state.atr, s.state.prev_close,
+    s.state.price_high, s.state.price_low)
+
 int ti_ce_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_ce_stream *ptr = static_cast<ti_ce_stream*>(stream);
     int progress = ptr->progress;
@@ -340,3 +346,30 @@ int ti_ce_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     return TI_OKAY;
 }
+
+int ti_ce_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ce_stream const *ptr = static_cast<ti_ce_stream const*>(stream);
+    const int progress = ptr->progress;
+    const int period = ptr->options.period;
+    if (progress < 0 || progress < -period+1 + 1) { return TI_OKAY; }
+
+    const TI_REAL high = inputs[0][0];
+    const TI_REAL low = inputs[1][0];
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL coef = ptr->options.coef;
+
+    const TI_REAL prev_close = ptr->state.prev_close;
+    const TI_REAL truerange = std::max(high, prev_close) - std::min(low, prev_close);
+    const TI_REAL atr = progress == 0 ? ptr->state.atr + truerange * per : (truerange - ptr->state.atr) * per + ptr->state.atr;
+
+    /* when the extremum leaves the window, take the one of the period-1 bars kept; find_max only reads the rings */
+    auto &price_high = const_cast<ringbuf_minmax<0>&>(ptr->state.price_high);
+    auto &price_low = const_cast<ringbuf_minmax<0>&>(ptr->state.price_low);
+    const TI_REAL max = ptr->state.max_idx == progress - period ? *price_high.find_max(period) : ptr->state.max;
+    const TI_REAL min = ptr->state.min_idx == progress - period ? *price_low.find_min(period) : ptr->state.min;
+
+    outputs[0][0] = (high >= max ? high : max) - coef * atr;
+    outputs[1][0] = (low <= min ? low : min) + coef * atr;
+
+    return TI_OKAY;
+}
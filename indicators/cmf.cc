@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 /* Source:
  * Kirkpatrick, Dahlquist. Technical Analysis: The Complete Resource for Financial Market Technicians (2 ed.)
@@ -53,3 +57,96 @@ int ti_cmf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_cmf_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_cmf_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL period_volume;
+        TI_REAL period_ad_sum;
+        ringbuf<0> volume;
+        ringbuf<0> ad;
+    } state;
+};
+
+
+int ti_cmf_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_cmf_stream *ptr = new(std::nothrow) ti_cmf_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_CMF_INDEX;
+    ptr->progress = -ti_cmf_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.volume.resize(period);
+        ptr->state.ad.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_cmf_stream_free(ti_stream *stream) {
+    delete static_cast<ti_cmf_stream*>(stream);
+}
+
+STREAM_IO(cmf, s.state.period_volume, s.state.period_ad_sum, s.state.volume, s.state.ad)
+
+int ti_cmf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_cmf_stream *ptr = static_cast<ti_cmf_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    const TI_REAL *volume = inputs[3];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+
+    TI_REAL period_volume = ptr->state.period_volume;
+    TI_REAL period_ad_sum = ptr->state.period_ad_sum;
+    auto &volumes = ptr->state.volume;
+    auto &ad = ptr->state.ad;
+
+    #define CHAIKIN_AD(i) (high[i] - low[i] ? volume[i] * ((close[i] - low[i]) - (high[i] - close[i])) / (high[i] - low[i]) : 0.)
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(volumes), step(ad)) {
+        ad = CHAIKIN_AD(i);
+        volumes = volume[i];
+        period_ad_sum += ad;
+        period_volume += volumes;
+    }
+    for (; i < size; ++i, ++progress, step(volumes), step(ad)) {
+        ad = CHAIKIN_AD(i);
+        volumes = volume[i];
+        period_ad_sum += ad;
+        period_volume += volumes;
+
+        *output++ = (period_volume ? period_ad_sum / period_volume : 0);
+
+        period_ad_sum -= ad[period-1];
+        period_volume -= volumes[period-1];
+    }
+
+    #undef CHAIKIN_AD
+
+    ptr->progress = progress;
+    ptr->state.period_volume = period_volume;
+    ptr->state.period_ad_sum = period_ad_sum;
+
+    return TI_OKAY;
+}
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_cmi_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -113,7 +114,7 @@ DONTOPTIMIZE int ti_cmi_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_cmi_stream : ti_stream {
+struct ti_cmi_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -126,7 +127,7 @@ struct ti_cmi_stream : ti_stream {
         TI_REAL hh_idx;
         TI_REAL ll_idx;
 
-        ringbuf<0> tr;
+        ringbuf_minmax<0> tr;
         ringbuf<0> price_close;
     } state;
 
@@ -146,6 +147,7 @@ int ti_cmi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_CMI_INDEX;
     ptr->progress = -ti_cmi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -156,9 +158,13 @@ int ti_cmi_stream_new(TI_REAL const *options, ti_stream **stream) {
 }
 
 void ti_cmi_stream_free(ti_stream *stream) {
-    delete stream;
+    delete static_cast<ti_cmi_stream*>(stream);
 }
 
+STREAM_IO(cmi,
+    s.state.sum, s.state.hh, s.state.ll, s.state.hh_idx, s.state.ll_idx, s.state.tr,
+    s.state.price_close)
+
 int ti_cmi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_cmi_stream *ptr = static_cast<ti_cmi_stream*>(stream);
 
@@ -205,7 +211,7 @@ int ti_cmi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
         tr = std::max(high[i], price_close[1]) - std::min(low[i], price_close[1]);
         sum += tr;
         if (hh_idx == progress - period) {
-            auto it = std::max_element(tr.phbegin(), tr.phend());
+            auto it = tr.find_max(period);
             hh = *it;
             hh_idx = progress - tr.iterator_to_age(it);
         } else if (hh <= tr) {
@@ -213,7 +219,7 @@ int ti_cmi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
             hh_idx = progress;
         }
         if (ll_idx == progress - period) {
-            auto it = std::min_element(tr.phbegin(), tr.phend());
+            auto it = tr.find_min(period);
             ll = *it;
             ll_idx = progress - tr.iterator_to_age(it);
         } else if (ll >= tr) {
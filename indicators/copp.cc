@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_copp_start(TI_REAL const *options) {
@@ -114,7 +115,7 @@ int ti_copp_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_copp_stream : ti_stream {
+struct ti_copp_stream : stream_base {
     struct {
         int roc_shorter_period;
         int roc_longer_period;
@@ -153,6 +154,7 @@ int ti_copp_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_COPP_INDEX;
     ptr->progress = -ti_copp_start(options);
+    ptr->keep_options(options);
 
     ptr->options.roc_shorter_period = roc_shorter_period;
     ptr->options.roc_longer_period = roc_longer_period;
@@ -177,6 +179,10 @@ void ti_copp_stream_free(ti_stream *stream) {
     delete static_cast<ti_copp_stream*>(stream);
 }
 
+STREAM_IO(copp,
+    s.state.price_sum, s.state.flat_rocs_sum, s.state.weighted_rocs_sum, s.state.price,
+    s.state.rocs)
+
 int ti_copp_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_copp_stream *ptr = static_cast<ti_copp_stream*>(stream);
     int progress = ptr->progress;
@@ -5,8 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_cvi_start(TI_REAL const *options) {
@@ -50,3 +54,88 @@ int ti_cvi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_cvi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_cvi_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL val;
+        ringbuf<0> lag;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_cvi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_cvi_stream *ptr = new(std::nothrow) ti_cvi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_CVI_INDEX;
+    ptr->progress = -ti_cvi_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 2 / ((TI_REAL)period + 1);
+
+    try {
+        ptr->state.lag.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_cvi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_cvi_stream*>(stream);
+}
+
+STREAM_IO(cvi, s.state.val, s.state.lag)
+
+int ti_cvi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_cvi_stream *ptr = static_cast<ti_cvi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL val = ptr->state.val;
+    auto &lag = ptr->state.lag;
+
+    int i = 0;
+    for (; i < size && progress == -(period*2-1); ++i, ++progress) {
+        val = high[i]-low[i];
+    }
+    for (; i < size && progress < 0; ++i, ++progress, step(lag)) {
+        val = ((high[i]-low[i])-val) * per + val;
+        lag = val;
+    }
+    for (; i < size; ++i, ++progress, step(lag)) {
+        val = ((high[i]-low[i])-val) * per + val;
+        /* before the assignment, the ring holds the value of period bars ago */
+        const TI_REAL old = lag;
+        *output++ = val - old ? 100.0 * (val - old) / old : 0;
+        lag = val;
+    }
+
+    ptr->progress = progress;
+    ptr->state.val = val;
+
+    return TI_OKAY;
+}
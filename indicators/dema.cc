@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_dema_start(TI_REAL const *options) {
@@ -49,3 +52,106 @@ int ti_dema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(output - outputs[0] == size - ti_dema_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_dema_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL ema;
+        TI_REAL ema2;
+    } state;
+
+    struct {
+        TI_REAL per;
+        TI_REAL per1;
+    } constants;
+};
+
+
+int ti_dema_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_dema_stream *ptr = new(std::nothrow) ti_dema_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_DEMA_INDEX;
+    ptr->progress = -ti_dema_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 2 / ((TI_REAL)period + 1);
+    ptr->constants.per1 = 1.0 - ptr->constants.per;
+
+    return TI_OKAY;
+}
+
+void ti_dema_stream_free(ti_stream *stream) {
+    delete static_cast<ti_dema_stream*>(stream);
+}
+
+STREAM_IO(dema, s.state)
+
+int ti_dema_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_dema_stream *ptr = static_cast<ti_dema_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL per1 = ptr->constants.per1;
+
+    TI_REAL ema = ptr->state.ema;
+    TI_REAL ema2 = ptr->state.ema2;
+
+    /* the bar index of the batch loop is progress + (period-1) * 2, the last seeding is at progress 0 */
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress) {
+        const int bar = progress + (period-1) * 2;
+        if (bar == 0) {
+            ema = input[i];
+        }
+        ema = ema * per1 + input[i] * per;
+        if (bar == period-1) {
+            ema2 = ema;
+        }
+        if (bar >= period-1) {
+            ema2 = ema2 * per1 + ema * per;
+        }
+        if (progress == 0) {
+            *output++ = ema * 2 - ema2;
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        ema = ema * per1 + input[i] * per;
+        ema2 = ema2 * per1 + ema * per;
+        *output++ = ema * 2 - ema2;
+    }
+
+    ptr->progress = progress;
+    ptr->state.ema = ema;
+    ptr->state.ema2 = ema2;
+
+    return TI_OKAY;
+}
+
+int ti_dema_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_dema_stream const *ptr = static_cast<ti_dema_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    /* both emas are seeded by progress 0, except for period 1, where per1 is 0 and the seeds do not matter */
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL per1 = ptr->constants.per1;
+    const TI_REAL ema = ptr->state.ema * per1 + inputs[0][0] * per;
+    const TI_REAL ema2 = ptr->state.ema2 * per1 + ema * per;
+    outputs[0][0] = ema * 2 - ema2;
+
+    return TI_OKAY;
+}
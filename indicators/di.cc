@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "dx.h"
+#include "../utils/stream.hh"
 
 
 int ti_di_start(TI_REAL const *options) {
@@ -77,3 +78,83 @@ int ti_di(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
 
     return TI_OKAY;
 }
+
+
+struct ti_di_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        dm_state dm;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_di_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_di_stream *ptr = new(std::nothrow) ti_di_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_DI_INDEX;
+    ptr->progress = -ti_di_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = ((TI_REAL)period-1) / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_di_stream_free(ti_stream *stream) {
+    delete static_cast<ti_di_stream*>(stream);
+}
+
+STREAM_IO(di, s.state)
+
+int ti_di_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_di_stream *ptr = static_cast<ti_di_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *plus_di = outputs[0];
+    TI_REAL *minus_di = outputs[1];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    dm_state dm = ptr->state.dm;
+
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress) {
+        if (progress == -(period-1)) {
+            dm.first(high[i], low[i], close[i]);
+        } else {
+            dm.update(high[i], low[i], close[i], 1);
+        }
+        if (progress == 0) {
+            *plus_di++  = dm.dmup ? 100.0 * dm.dmup / dm.atr : 0;
+            *minus_di++ = dm.dmdown ? 100.0 * dm.dmdown / dm.atr : 0;
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        dm.update(high[i], low[i], close[i], per);
+        *plus_di++  = dm.dmup ? 100.0 * dm.dmup / dm.atr : 0;
+        *minus_di++ = dm.dmdown ? 100.0 * dm.dmdown / dm.atr : 0;
+    }
+
+    ptr->progress = progress;
+    ptr->state.dm = dm;
+
+    return TI_OKAY;
+}
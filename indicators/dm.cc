@@ -5,8 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "dx.h"
+#include "../utils/stream.hh"
 
 
 int ti_dm_start(TI_REAL const *options) {
@@ -62,3 +65,82 @@ int ti_dm(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     assert(minus_dm - outputs[1] == size - ti_dm_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_dm_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        dm_state dm;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_dm_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_dm_stream *ptr = new(std::nothrow) ti_dm_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_DM_INDEX;
+    ptr->progress = -ti_dm_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = ((TI_REAL)period-1) / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_dm_stream_free(ti_stream *stream) {
+    delete static_cast<ti_dm_stream*>(stream);
+}
+
+STREAM_IO(dm, s.state)
+
+int ti_dm_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_dm_stream *ptr = static_cast<ti_dm_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *plus_dm = outputs[0];
+    TI_REAL *minus_dm = outputs[1];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    dm_state dm = ptr->state.dm;
+
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress) {
+        if (progress == -(period-1)) {
+            dm.first(high[i], low[i]);
+        } else {
+            dm.update(high[i], low[i], 1);
+        }
+        if (progress == 0) {
+            *plus_dm++ = dm.dmup;
+            *minus_dm++ = dm.dmdown;
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        dm.update(high[i], low[i], per);
+        *plus_dm++ = dm.dmup;
+        *minus_dm++ = dm.dmdown;
+    }
+
+    ptr->progress = progress;
+    ptr->state.dm = dm;
+
+    return TI_OKAY;
+}
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_dwma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -91,7 +92,7 @@ int ti_dwma_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_dwma_stream : ti_stream {
+struct ti_dwma_stream : stream_base {
 
     struct {
         int period;
@@ -124,6 +125,7 @@ int ti_dwma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_DWMA_INDEX;
     ptr->progress = -ti_dwma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -150,6 +152,9 @@ void ti_dwma_stream_free(ti_stream *stream) {
     delete static_cast<ti_dwma_stream*>(stream);
 }
 
+STREAM_IO(dwma,
+    s.state.price, s.state.numer1, s.state.sum1, s.state.filt1, s.state.numer2, s.state.sum2)
+
 int ti_dwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_dwma_stream *ptr = static_cast<ti_dwma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
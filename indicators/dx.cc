@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "dx.h"
+#include "../utils/stream.hh"
 
 
 int ti_dx_start(TI_REAL const *options) {
@@ -80,3 +81,79 @@ int ti_dx(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     assert(output - outputs[0] == size - ti_dx_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_dx_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        dm_state dm;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_dx_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_dx_stream *ptr = new(std::nothrow) ti_dx_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_DX_INDEX;
+    ptr->progress = -ti_dx_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = ((TI_REAL)period-1) / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_dx_stream_free(ti_stream *stream) {
+    delete static_cast<ti_dx_stream*>(stream);
+}
+
+STREAM_IO(dx, s.state)
+
+int ti_dx_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_dx_stream *ptr = static_cast<ti_dx_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    dm_state dm = ptr->state.dm;
+
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress) {
+        if (progress == -(period-1)) {
+            dm.first(high[i], low[i]);
+        } else {
+            dm.update(high[i], low[i], 1);
+        }
+        if (progress == 0) {
+            *output++ = dm.dx();
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        dm.update(high[i], low[i], per);
+        *output++ = dm.dx();
+    }
+
+    ptr->progress = progress;
+    ptr->state.dm = dm;
+
+    return TI_OKAY;
+}
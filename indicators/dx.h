@@ -19,21 +19,73 @@
 
 
 
+/* +DM and -DM of a bar given the high and low of the one before */
+static inline void dm_direction(TI_REAL h, TI_REAL l, TI_REAL prev_high, TI_REAL prev_low, TI_REAL &up, TI_REAL &down) {
+    up = h - prev_high;
+    down = prev_low - l;
+
+    if (up < 0)
+        up = 0;
+    else if (up > down)
+        down = 0;
+
+    if (down < 0)
+        down = 0;
+    else if (down > up)
+        up = 0;
+}
+
 #define CALC_DIRECTION(up, down) do {\
-        up = high[i] - high[i-1];\
-        down = low[i-1] - low[i];\
-\
-        if (up < 0)\
-            up = 0;\
-        else if (up > down)\
-            down = 0;\
-\
-        if (down < 0)\
-            down = 0;\
-        else if (down > up)\
-            up = 0;\
+        dm_direction(high[i], low[i], high[i-1], low[i-1], up, down);\
 } while (0)
 
 
+/* dx from the Wilder sums of +DM and -DM */
+
+static inline TI_REAL dm_dx(TI_REAL dmup, TI_REAL dmdown) {
+    TI_REAL dm_diff = fabs(dmup - dmdown);
+    TI_REAL dm_sum = dmup + dmdown;
+    TI_REAL result = dm_diff / dm_sum * 100;
+    if (dm_sum == 0) { result = 0; }
+    return result;
+}
+
+
+/* The same for the streams and the plan nodes, bar by bar: the moves of the bars 1..period-1 are summed and
+ * the later ones smoothed, update() taking per = 1 while summing, which is exact.
+ */
+
+struct dm_state {
+    TI_REAL dmup, dmdown;       /* the Wilder sums of +DM and -DM */
+    TI_REAL atr;                /* and of the true range, di only */
+    TI_REAL high, low, close;   /* the previous bar */
+
+    void first(TI_REAL h, TI_REAL l, TI_REAL c = 0) {
+        high = h;
+        low = l;
+        close = c;
+    }
+
+    void update(TI_REAL h, TI_REAL l, TI_REAL per) {
+        TI_REAL up, down;
+        dm_direction(h, l, high, low, up, down);
+
+        dmup = dmup * per + up;
+        dmdown = dmdown * per + down;
+        high = h;
+        low = l;
+    }
+
+    void update(TI_REAL h, TI_REAL l, TI_REAL c, TI_REAL per) {
+        atr = atr * per + truerange_of(h, l, close);
+        close = c;
+        update(h, l, per);
+    }
+
+    TI_REAL dx() const {
+        return dm_dx(dmup, dmdown);
+    }
+};
+
 
 #endif /*__DX_H__*/
@@ -11,6 +11,8 @@
 #include "../indicators.h"
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_edcf_start(TI_REAL const *options) {
@@ -19,7 +21,46 @@ int ti_edcf_start(TI_REAL const *options) {
     return 2*length-1;
 }
 
-int ti_edcf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* After a bar, the distance of each price becomes that of the one before it:
+ * only the distance of the newest price is computed, the others are kept in a ring. */
+
+int ti_edcf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
+    TI_REAL const *const series = inputs[0];
+    const int length = options[0];
+    TI_REAL *edcf = outputs[0];
+
+    if (length < 1) { return TI_INVALID_OPTION; }
+
+    ringbuf<0> price(length);
+    ringbuf<0> distance2(length);
+
+    int progress = -ti_edcf_start(options);
+    for (int i = 0; i < size; ++i, ++progress, step(price, distance2)) {
+        price = series[i];
+
+        TI_REAL d = 0;
+        for (int lookback = 1; lookback < length; ++lookback) {
+            d += (price - price[lookback]) * (price - price[lookback]);
+        }
+        distance2 = d;
+
+        if (progress >= 0) {
+            TI_REAL num = 0.;
+            TI_REAL sumcoef = 0.;
+            for (int count = 0; count < length; ++count) {
+                num += distance2[count] * price[count];
+                sumcoef += distance2[count];
+            }
+            *edcf++ = (sumcoef != 0. ? num / sumcoef : 0.);
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+int ti_edcf_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     TI_REAL const *const series = inputs[0];
     TI_REAL length = options[0];
     TI_REAL *edcf = outputs[0];
@@ -62,16 +103,15 @@ int ti_edcf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     return TI_OKAY;
 }
 
-struct ti_edcf_stream : ti_stream {
+struct ti_edcf_stream : stream_base {
 
     struct {
-        TI_REAL length;
+        int length;
     } options;
 
     struct {
-        std::vector<TI_REAL> coef;
-        std::vector<TI_REAL> distance2;
-        std::deque<TI_REAL> price;
+        ringbuf<0> price;
+        ringbuf<0> distance2;
     } state;
 
     struct {
@@ -80,8 +120,7 @@ struct ti_edcf_stream : ti_stream {
 };
 
 int ti_edcf_stream_new(TI_REAL const *options, ti_stream **stream) {
-    TI_REAL lookback = options[0];
-    TI_REAL length = options[0];
+    const int length = options[0];
 
     if (length < 1) { return TI_INVALID_OPTION; }
 
@@ -91,11 +130,17 @@ int ti_edcf_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_EDCF_INDEX;
     ptr->progress = -ti_edcf_start(options);
+    ptr->keep_options(options);
 
     ptr->options.length = length;
 
-    ptr->state.coef.resize(2*length);
-    ptr->state.distance2.resize(2*length);
+    try {
+        ptr->state.price.resize(length);
+        ptr->state.distance2.resize(length);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
 
     return TI_OKAY;
 }
@@ -104,40 +149,36 @@ void ti_edcf_stream_free(ti_stream *stream) {
     delete static_cast<ti_edcf_stream*>(stream);
 }
 
+STREAM_IO(edcf, s.state.price, s.state.distance2)
+
 int ti_edcf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_edcf_stream *ptr = static_cast<ti_edcf_stream*>(stream);
     TI_REAL const *const series = inputs[0];
     TI_REAL *edcf = outputs[0];
     int progress = ptr->progress;
-    TI_REAL length = ptr->options.length;
+    const int length = ptr->options.length;
 
     auto &price = ptr->state.price;
-    auto &coef = ptr->state.coef;
     auto &distance2 = ptr->state.distance2;
 
-    int i = 0;
-    for (; i < size && progress < 0; ++i, ++progress) {
-        price.push_front(series[i]);
-    }
-    for (; i < size; ++i, ++progress) {
-        price.push_front(series[i]);
-        for (int count = 0; count < length; ++count) {
-            distance2[count] = 0;
-            for (int lookback = 1; lookback < length; ++lookback) {
-                distance2[count] += (price[count] - price[count+lookback]) * (price[count] - price[count+lookback]);
-            }
-            coef[count] = distance2[count];
-        }
+    for (int i = 0; i < size; ++i, ++progress, step(price, distance2)) {
+        price = series[i];
 
-        TI_REAL num = 0.;
-        TI_REAL sumcoef = 0.;
-        for (int count = 0; count < length; ++count) {
-            num += coef[count] * price[count];
-            sumcoef += coef[count];
+        TI_REAL d = 0;
+        for (int lookback = 1; lookback < length; ++lookback) {
+            d += (price - price[lookback]) * (price - price[lookback]);
+        }
+        distance2 = d;
+
+        if (progress >= 0) {
+            TI_REAL num = 0.;
+            TI_REAL sumcoef = 0.;
+            for (int count = 0; count < length; ++count) {
+                num += distance2[count] * price[count];
+                sumcoef += distance2[count];
+            }
+            *edcf++ = (sumcoef != 0. ? num / sumcoef : 0.);
         }
-        *edcf++ = (sumcoef != 0. ? num / sumcoef : 0.);
-
-        price.pop_back();
     }
 
     ptr->progress = progress;
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_ehma_start(TI_REAL const *options) {
     const int period = options[0];
@@ -85,7 +86,7 @@ DONTOPTIMIZE int ti_ehma_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_ehma_stream : ti_stream {
+struct ti_ehma_stream : stream_base {
 
     struct {
         int period;
@@ -115,6 +116,7 @@ int ti_ehma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_EHMA_INDEX;
     ptr->progress = -ti_ehma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -129,6 +131,8 @@ void ti_ehma_stream_free(ti_stream *stream) {
     delete static_cast<ti_ehma_stream*>(stream);
 }
 
+STREAM_IO(ehma, s.state)
+
 int ti_ehma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_ehma_stream *ptr = static_cast<ti_ehma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -5,7 +5,14 @@
  */
 
 
+#include <new>
+#include <vector>
+
 #include "../indicators.h"
+#include "../utils/minmax.h"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
+#include "../utils/stream.hh"
 
 
 int ti_ema_start(TI_REAL const *options) {
@@ -37,3 +44,145 @@ int ti_ema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_ema_start(options));
     return TI_OKAY;
 }
+
+
+int ti_ema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    const TI_REAL *input = inputs[0];
+    const int period = (int)options[0];
+    TI_REAL *output = outputs[0];
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (!range_check(size, ti_ema_start(options), first_output, count)) return TI_INVALID_OPTION;
+    if (count == 0) return TI_OKAY;
+
+    const TI_REAL per = 2 / ((TI_REAL)period + 1);
+
+    /* The ema never forgets, so warm up over the whole head, without the stores. */
+    TI_REAL val = input[0];
+    int i;
+    for (i = 1; i <= first_output; ++i) {
+        val = (input[i]-val) * per + val;
+    }
+    *output++ = val;
+
+    for (; i < first_output + count; ++i) {
+        val = (input[i]-val) * per + val;
+        *output++ = val;
+    }
+
+    assert(output - outputs[0] == count);
+    return TI_OKAY;
+}
+
+int ti_ema_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    std::vector<TI_REAL> val(nparams, input[0]);
+    for (int p = 0; p < nparams; ++p) {
+        multi_output(outputs, 0, size, p)[0] = input[0];
+    }
+
+    for (int tile = 1; tile < size; tile += multi_tile) {
+        const int tile_end = MIN(size, tile + multi_tile);
+
+        for (int p = 0; p < nparams; ++p) {
+            const int period = (int)multi_options(options, 1, p)[0];
+            const TI_REAL per = 2 / ((TI_REAL)period + 1);
+            TI_REAL *output = multi_output(outputs, 0, size, p);
+
+            TI_REAL v = val[p];
+            for (int i = tile; i < tile_end; ++i) {
+                v = (input[i]-v) * per + v;
+                output[i] = v;
+            }
+            val[p] = v;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+struct ti_ema_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL val;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_ema_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_ema_stream *ptr = new(std::nothrow) ti_ema_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_EMA_INDEX;
+    ptr->progress = -ti_ema_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 2 / ((TI_REAL)period + 1);
+
+    return TI_OKAY;
+}
+
+void ti_ema_stream_free(ti_stream *stream) {
+    delete static_cast<ti_ema_stream*>(stream);
+}
+
+STREAM_IO(ema, s.state)
+
+int ti_ema_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ema_stream *ptr = static_cast<ti_ema_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL val = ptr->state.val;
+
+    int i = 0;
+    for (; i < size && progress == 0; ++i, ++progress) {
+        val = input[i];
+        *output++ = val;
+    }
+    for (; i < size; ++i, ++progress) {
+        val = (input[i]-val) * per + val;
+        *output++ = val;
+    }
+
+    ptr->progress = progress;
+    ptr->state.val = val;
+
+    return TI_OKAY;
+}
+
+int ti_ema_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ema_stream const *ptr = static_cast<ti_ema_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL val = ptr->state.val;
+    outputs[0][0] = ptr->progress == 0 ? inputs[0][0] : (inputs[0][0]-val) * ptr->constants.per + val;
+
+    return TI_OKAY;
+}
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_emsd_start(TI_REAL const *options) {
     const int period = options[0];
@@ -106,7 +107,7 @@ DONTOPTIMIZE int ti_emsd_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_emsd_stream : ti_stream {
+struct ti_emsd_stream : stream_base {
 
     struct {
         int period;
@@ -139,6 +140,7 @@ int ti_emsd_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_EMSD_INDEX;
     ptr->progress = -ti_emsd_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.ma_period = ma_period;
@@ -155,6 +157,8 @@ void ti_emsd_stream_free(ti_stream *stream) {
     delete static_cast<ti_emsd_stream*>(stream);
 }
 
+STREAM_IO(emsd, s.state.sum, s.state.sum2, s.state.ema, s.state.price)
+
 int ti_emsd_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_emsd_stream *ptr = static_cast<ti_emsd_stream*>(stream);
     TI_REAL const *const series = inputs[0];
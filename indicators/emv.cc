@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_emv_start(TI_REAL const *options) {
@@ -39,3 +42,58 @@ int ti_emv(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_emv_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_emv_stream : stream_base {
+    struct {
+        TI_REAL last;
+    } state;
+};
+
+
+int ti_emv_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_emv_stream *ptr = new(std::nothrow) ti_emv_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_EMV_INDEX;
+    ptr->progress = -ti_emv_start(options);
+    ptr->keep_options(options);
+
+    return TI_OKAY;
+}
+
+void ti_emv_stream_free(ti_stream *stream) {
+    delete static_cast<ti_emv_stream*>(stream);
+}
+
+STREAM_IO(emv, s.state)
+
+int ti_emv_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_emv_stream *ptr = static_cast<ti_emv_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *volume = inputs[2];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL last = ptr->state.last;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        last = (high[i] + low[i]) * 0.5;
+    }
+    for (; i < size; ++i, ++progress) {
+        TI_REAL hl = (high[i] + low[i]) * 0.5;
+        TI_REAL br = volume[i] / 10000.0 / (high[i] - low[i]);
+
+        *output++ = hl - last ? (hl - last) / br : 0;
+        last = hl;
+    }
+
+    ptr->progress = progress;
+    ptr->state.last = last;
+
+    return TI_OKAY;
+}
@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_er_start(TI_REAL const *options) {
     const int period = options[0];
@@ -62,7 +63,7 @@ DONTOPTIMIZE int ti_er_ref(int size, TI_REAL const *const *inputs, TI_REAL const
     return TI_OKAY;
 }
 
-struct ti_er_stream : ti_stream {
+struct ti_er_stream : stream_base {
 
     struct {
         int period;
@@ -90,6 +91,7 @@ int ti_er_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_ER_INDEX;
     ptr->progress = -ti_er_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -102,6 +104,8 @@ void ti_er_stream_free(ti_stream *stream) {
     delete static_cast<ti_er_stream*>(stream);
 }
 
+STREAM_IO(er, s.state.trajectory, s.state.price)
+
 int ti_er_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_er_stream *ptr = static_cast<ti_er_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_evwma_start(TI_REAL const *options) {
     const int period = options[0];
@@ -81,7 +82,7 @@ DONTOPTIMIZE int ti_evwma_ref(int size, TI_REAL const *const *inputs, TI_REAL co
     return TI_OKAY;
 }
 
-struct ti_evwma_stream : ti_stream {
+struct ti_evwma_stream : stream_base {
 
     struct {
         int period;
@@ -112,6 +113,7 @@ int ti_evwma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_EVWMA_INDEX;
     ptr->progress = -ti_evwma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.gamma = gamma;
@@ -129,6 +131,8 @@ void ti_evwma_stream_free(ti_stream *stream) {
     delete static_cast<ti_evwma_stream*>(stream);
 }
 
+STREAM_IO(evwma, s.state.filt, s.state.N, s.state.volume)
+
 int ti_evwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_evwma_stream *ptr = static_cast<ti_evwma_stream*>(stream);
     TI_REAL const *const close = inputs[0];
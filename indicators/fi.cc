@@ -5,8 +5,10 @@
 
 
 #include <new>
+#include <vector>
 
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_fi_start(TI_REAL const *options) {
@@ -52,7 +54,7 @@ int ti_fi_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     return TI_OKAY;
 }
 
-struct ti_fi_stream : ti_stream {
+struct ti_fi_stream : stream_base {
 
     TI_REAL per;
     TI_REAL ema;
@@ -69,6 +71,7 @@ int ti_fi_stream_new(TI_REAL const *options, ti_stream **stream) {
     ptr->per = 2. / (period + 1.);
     ptr->index = TI_INDICATOR_FI_INDEX;
     ptr->progress = -1;
+    ptr->keep_options(options);
 
     return TI_OKAY;
 }
@@ -77,6 +80,8 @@ void ti_fi_stream_free(ti_stream *stream) {
     delete static_cast<ti_fi_stream*>(stream);
 }
 
+STREAM_IO(fi, s.ema, s.previous_close)
+
 int ti_fi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_fi_stream *ptr = static_cast<ti_fi_stream*>(stream);
     int progress = ptr->progress;
@@ -110,3 +115,94 @@ int ti_fi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     return TI_OKAY;
 }
+
+int ti_fi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_fi_stream const *ptr = static_cast<ti_fi_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL force = inputs[1][0] * (inputs[0][0] - ptr->previous_close);
+    outputs[0][0] = ptr->progress == 0 ? force : (force - ptr->ema) * ptr->per + ptr->ema;
+
+    return TI_OKAY;
+}
+
+
+struct ti_fi_batch : ti_batch {
+    struct {
+        TI_REAL period;
+    } options;
+
+    struct {
+        std::vector<TI_REAL> ema;
+        std::vector<TI_REAL> previous_close;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+int ti_fi_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch) {
+    TI_REAL const period = options[0];
+    if (period < 1) { return TI_INVALID_OPTION; }
+    if (nsymbols < 1) { return TI_INVALID_OPTION; }
+
+    ti_fi_batch *ptr = new(std::nothrow) ti_fi_batch();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *batch = ptr;
+
+    ptr->index = TI_INDICATOR_FI_INDEX;
+    ptr->progress = -ti_fi_start(options);
+    ptr->nsymbols = nsymbols;
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 2. / (period + 1.);
+
+    try {
+        ptr->state.ema.resize(nsymbols);
+        ptr->state.previous_close.resize(nsymbols);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_fi_batch_free(ti_batch *batch) {
+    delete static_cast<ti_fi_batch*>(batch);
+}
+
+int ti_fi_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_fi_batch *ptr = static_cast<ti_fi_batch*>(batch);
+    const int nsymbols = ptr->nsymbols;
+    const int progress = ptr->progress;
+
+    TI_REAL const *close = inputs[0];
+    TI_REAL const *volume = inputs[1];
+    TI_REAL *fi = outputs[0];
+
+    const TI_REAL per = ptr->constants.per;
+    TI_REAL *const ema = ptr->state.ema.data();
+    TI_REAL *const previous_close = ptr->state.previous_close.data();
+
+    if (progress == 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            ema[s] = volume[s] * (close[s] - previous_close[s]);
+            fi[s] = ema[s];
+        }
+    } else if (progress > 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            ema[s] = (volume[s] * (close[s] - previous_close[s]) - ema[s]) * per + ema[s];
+            fi[s] = ema[s];
+        }
+    }
+    for (int s = 0; s < nsymbols; ++s) {
+        previous_close[s] = close[s];
+    }
+
+    ptr->progress = progress + 1;
+
+    return TI_OKAY;
+}
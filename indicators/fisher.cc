@@ -8,6 +8,8 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_fisher_start(TI_REAL const *options) {
@@ -89,3 +91,90 @@ int ti_fisher(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     assert(signal - outputs[1] == size - ti_fisher_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_fisher_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL val1;
+        TI_REAL fish;
+        ringbuf_minmax<0> price;
+    } state;
+};
+
+
+int ti_fisher_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_fisher_stream *ptr = new(std::nothrow) ti_fisher_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_FISHER_INDEX;
+    ptr->progress = -ti_fisher_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_fisher_stream_free(ti_stream *stream) {
+    delete static_cast<ti_fisher_stream*>(stream);
+}
+
+STREAM_IO(fisher, s.state.val1, s.state.fish, s.state.price)
+
+int ti_fisher_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_fisher_stream *ptr = static_cast<ti_fisher_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *fisher = outputs[0];
+    TI_REAL *signal = outputs[1];
+
+    const int period = ptr->options.period;
+
+    TI_REAL val1 = ptr->state.val1;
+    TI_REAL fish = ptr->state.fish;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = HL(i);
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        price = HL(i);
+
+        const TI_REAL max = *price.find_max(period);
+        const TI_REAL min = *price.find_min(period);
+
+        TI_REAL mm = max - min;
+        if (mm == 0.0) mm = 0.001;
+        val1 = 0.33 * 2.0 * ( (HL(i)-min) / (mm) - 0.5) + 0.67 * val1;
+        if (val1 > 0.99) val1 = .999;
+        if (val1 < -0.99) val1 = -.999;
+
+        *signal++ = fish;
+        fish = 0.5 * log((1.0+val1)/(1.0-val1)) + 0.5 * fish;
+        *fisher++ = fish;
+    }
+
+    ptr->progress = progress;
+    ptr->state.val1 = val1;
+    ptr->state.fish = fish;
+
+    return TI_OKAY;
+}
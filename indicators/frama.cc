@@ -4,12 +4,13 @@
  */
 
 
-#include <queue>
 #include <new>
 
 #include "../indicators.h"
 #include "../utils/log.h"
 #include "../utils/minmax.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_frama_start(TI_REAL const *options) {
@@ -19,8 +20,93 @@ int ti_frama_start(TI_REAL const *options) {
     return 0;
 }
 
+/* The extremes of the newer half of the window come from rolling min/max over half_period bars,
+ * those of the older half are the same extremes half_period bars ago, delayed by a ring,
+ * and those of the whole window are the extremes of the two halves.
+ */
+
+static TI_REAL frama_alpha(TI_REAL max1, TI_REAL min1, TI_REAL max2, TI_REAL min2, TI_REAL period, TI_REAL w) {
+    TI_REAL N3 = (MAX(max1, max2) - MIN(min1, min2)) / period;
+    TI_REAL N1 = (max1 - min1) / (period / 2);
+    TI_REAL N2 = (max2 - min2) / (period / 2);
+
+    TI_REAL dimen = 0;
+    if (N1 > 0 && N2 > 0 && N3 > 0) { dimen = (log(N1 + N2) - log(N3)) / log(2.); }
+
+    TI_REAL alpha = exp(w * (dimen - 1));
+    alpha = MAX(alpha, .01);
+    alpha = MIN(alpha, 1.);
+    return alpha;
+}
+
+/* Below this many bars the halves are scanned directly rather than kept on ringbuf_minmax */
+static const int minmax_period = 32;
+
+/* runs the filter over size bars, price_high and price_low holding the last half_period bars */
+template<class Ring>
+static void frama_run(int size, TI_REAL const *high, TI_REAL const *low, TI_REAL period, TI_REAL w, int &progress, TI_REAL &filt,
+        Ring &price_high, Ring &price_low, ringbuf<0> &older_high, ringbuf<0> &older_low, TI_REAL *frama) {
+    const int half_period = period / 2;
+
+    for (int i = 0; i < size; ++i, ++progress, step(price_high, price_low, older_high, older_low)) {
+        price_high = high[i];
+        price_low = low[i];
+
+        const TI_REAL max1 = *price_high.find_max(half_period);
+        const TI_REAL min1 = *price_low.find_min(half_period);
+        const TI_REAL max2 = older_high;
+        const TI_REAL min2 = older_low;
+        older_high = max1;
+        older_low = min1;
+
+        if (progress < period) {
+            /* our first data point just return (High + Low) / 2 */
+            filt = (high[i] + low[i]) / 2.;
+        } else {
+            const TI_REAL alpha = frama_alpha(max1, min1, max2, min2, period, w);
+            filt = alpha * (high[i] + low[i]) / 2. + (1. - alpha) * filt;
+        }
+        *frama++ = filt;
+    }
+}
+
 // original author: @HelloCreepy
-int ti_frama(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+int ti_frama(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
+    TI_REAL const *high = inputs[0];
+    TI_REAL const *low = inputs[1];
+    TI_REAL period = options[0];
+    TI_REAL average_period = options[1];
+    TI_REAL *frama = outputs[0];
+
+    if (period < 1) { return TI_INVALID_OPTION; }
+    if (average_period < 2) { return TI_INVALID_OPTION; }
+    if ((int)period % 2 != 0) { return TI_INVALID_OPTION; }
+    if (size <= ti_frama_start(options)) { return TI_OKAY; }
+
+    const TI_REAL w = log(2.0 / (1.0 + average_period));
+    const int half_period = period / 2;
+
+    ringbuf<0> older_high(half_period), older_low(half_period);
+
+    TI_REAL filt;
+    int progress = 0;
+
+    if (half_period < minmax_period) {
+        ringbuf<0> price_high(half_period), price_low(half_period);
+        frama_run(size, high, low, period, w, progress, filt, price_high, price_low, older_high, older_low, frama);
+    } else {
+        ringbuf_minmax<0> price_high, price_low;
+        price_high.resize(half_period);
+        price_low.resize(half_period);
+        frama_run(size, high, low, period, w, progress, filt, price_high, price_low, older_high, older_low, frama);
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+int ti_frama_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     TI_REAL const *high = inputs[0];
     TI_REAL const *low = inputs[1];
     TI_REAL period = options[0];
@@ -108,7 +194,7 @@ int ti_frama(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     return TI_OKAY;
 }
 
-struct ti_frama_stream : ti_stream {
+struct ti_frama_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -118,19 +204,14 @@ struct ti_frama_stream : ti_stream {
     struct {
         TI_REAL filt;
 
-        TI_REAL max1;
-        TI_REAL max2;
-        TI_REAL min1;
-        TI_REAL min2;
-        int max1_idx;
-        int max2_idx;
-        int min1_idx;
-        int min2_idx;
+        ringbuf<0> short_high; /* below minmax_period */
+        ringbuf<0> short_low; /* below minmax_period */
+        ringbuf_minmax<0> price_high; /* from minmax_period up */
+        ringbuf_minmax<0> price_low; /* from minmax_period up */
+        ringbuf<0> older_high;
+        ringbuf<0> older_low;
     } state;
 
-    std::deque<TI_REAL> high_store;
-    std::deque<TI_REAL> low_store;
-
     struct {
         TI_REAL w;
     } constants;
@@ -149,10 +230,29 @@ int ti_frama_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_FRAMA_INDEX;
     ptr->progress = -ti_frama_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.average_period = average_period;
 
+    ptr->state.filt = 0;
+
+    try {
+        const int half_period = period / 2;
+        if (half_period < minmax_period) {
+            ptr->state.short_high.resize(half_period);
+            ptr->state.short_low.resize(half_period);
+        } else {
+            ptr->state.price_high.resize(half_period);
+            ptr->state.price_low.resize(half_period);
+        }
+        ptr->state.older_high.resize(half_period);
+        ptr->state.older_low.resize(half_period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
     ptr->constants.w = log(2.0 / (1.0 + average_period));
 
     return TI_OKAY;
@@ -162,6 +262,10 @@ void ti_frama_stream_free(ti_stream *stream) {
     delete static_cast<ti_frama_stream*>(stream);
 }
 
+STREAM_IO(frama,
+    s.state.filt, s.state.short_high, s.state.short_low, s.state.price_high, s.state.price_low,
+    s.state.older_high, s.state.older_low)
+
 int ti_frama_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_frama_stream *ptr = static_cast<ti_frama_stream*>(stream);
     TI_REAL const *high = inputs[0];
@@ -169,161 +273,21 @@ int ti_frama_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
     TI_REAL *frama = outputs[0];
     int progress = ptr->progress;
     TI_REAL period = ptr->options.period; // N in the paper
-    TI_REAL average_period = ptr->options.average_period;
-
-    std::deque<TI_REAL> &high_store = ptr->high_store;
-    std::deque<TI_REAL> &low_store = ptr->low_store;
+    const int half_period = period / 2;
 
     TI_REAL w = ptr->constants.w;
     TI_REAL filt = ptr->state.filt;
 
-    TI_REAL max1 = ptr->state.max1;
-    TI_REAL max2 = ptr->state.max2;
-    TI_REAL min1 = ptr->state.min1;
-    TI_REAL min2 = ptr->state.min2;
-    int max1_idx = ptr->state.max1_idx;
-    int max2_idx = ptr->state.max2_idx;
-    int min1_idx = ptr->state.min1_idx;
-    int min2_idx = ptr->state.min2_idx;
-
-    int i = 0;
-    for (; i < size && progress == 0; ++i, ++progress) {
-        high_store.push_front(high[i]);
-        low_store.push_front(low[i]);
-        filt = (high[i] + low[i]) / 2.;
-        *frama++ = filt;
-
-        max2 = high[i];
-        min2 = low[i];
-        max2_idx = progress;
-        min2_idx = progress;
-    }
-    for (; i < size && progress < period/2; ++i, ++progress) {
-        high_store.push_front(high[i]);
-        low_store.push_front(low[i]);
-        filt = (high[i] + low[i]) / 2.;
-        *frama++ = filt;
-
-        if (max2 <= high[i]) {
-            max2 = high[i];
-            max2_idx = progress;
-        }
-        if (min2 >= low[i]) {
-            min2 = low[i];
-            min2_idx = progress;
-        }
-    }
-    for (; i < size && progress == (int)period/2; ++i, ++progress) {
-        high_store.push_front(high[i]);
-        low_store.push_front(low[i]);
-        filt = (high[i] + low[i]) / 2.;
-        *frama++ = filt;
-
-        max1 = high[i];
-        min1 = low[i];
-        max1_idx = progress;
-        min1_idx = progress;
-    }
-    for (; i < size && progress < period; ++i, ++progress) {
-        high_store.push_front(high[i]);
-        low_store.push_front(low[i]);
-        filt = (high[i] + low[i]) / 2.;
-        *frama++ = filt;
-
-        if (max1 <= high[i]) {
-            max1 = high[i];
-            max1_idx = progress;
-        }
-        if (min1 >= low[i]) {
-            min1 = low[i];
-            min1_idx = progress;
-        }
-    }
-    for (; i < size; ++i, ++progress) {
-        high_store.pop_back();
-        low_store.pop_back();
-        high_store.push_front(high[i]);
-        low_store.push_front(low[i]);
-
-        // the usual min/max maintaining machinery, done four times
-        if (max2_idx == progress - (int)period) {
-            max2 = high_store[(int)period - 1];
-            max2_idx = progress - ((int)period - 1);
-            for (int j = 1; j < period / 2; ++j) {
-                if (high_store[(int)period - 1 - j] >= max2) {
-                    max2 = high_store[(int)period - 1 - j];
-                    max2_idx = progress - ((int)period - 1 - j);
-                }
-            }
-        } else if (high_store[(int)(period / 2)] >= max2) {
-            max2 = high_store[(int)(period / 2)];
-            max2_idx = progress - ((int)(period / 2));
-        }
-        if (min2_idx == progress - (int)period) {
-            min2 = low_store[(int)period - 1];
-            min2_idx = progress - ((int)period - 1);
-            for (int j = 1; j < period / 2; ++j) {
-                if (low_store[(int)period - 1 - j] <= min2) {
-                    min2 = low_store[(int)period - 1 - j];
-                    min2_idx = progress - ((int)period - 1 - j);
-                }
-            }
-        } else if (low_store[(int)(period / 2)] <= min2) {
-            min2 = low_store[(int)(period / 2)];
-            min2_idx = progress - ((int)(period / 2));
-        }
-        if (max1_idx == progress - (int)period / 2) {
-            max1 = high_store[(int)period / 2 - 1];
-            max1_idx = progress - ((int)period / 2 - 1);
-            for (int j = 1; j < period / 2; ++j) {
-                if (high_store[(int)period / 2 - 1 - j] >= max1) {
-                    max1 = high_store[(int)period / 2 - 1 - j];
-                    max1_idx = progress - ((int)period / 2 - 1 - j);
-                }
-            }
-        } else if (high_store[0] >= max1) {
-            max1 = high_store[0];
-            max1_idx = progress - (0);
-        }
-        if (min1_idx == progress - (int)period / 2) {
-            min1 = low_store[(int)period / 2 - 1];
-            min1_idx = progress - ((int)period / 2 - 1);
-            for (int j = 1; j < period / 2; ++j) {
-                if (low_store[(int)period / 2 - 1 - j] <= min1) {
-                    min1 = low_store[(int)period / 2 - 1 - j];
-                    min1_idx = progress - ((int)period / 2 - 1 - j);
-                }
-            }
-        } else if (low_store[0] <= min1) {
-            min1 = low_store[0];
-            min1_idx = progress - (0);
-        }
-
-        TI_REAL N3 = (MAX(max1, max2) - MIN(min1, min2)) / period;
-        TI_REAL N1 = (max1 - min1) / (period / 2);
-        TI_REAL N2 = (max2 - min2) / (period / 2);
-
-        TI_REAL dimen = 0;
-        if (N1 > 0 && N2 > 0 && N3 > 0) { dimen = (log(N1 + N2) - log(N3)) / log(2.); }
-
-        TI_REAL alpha = exp(w * (dimen - 1));
-        alpha = MAX(alpha, .01);
-        alpha = MIN(alpha, 1.);
-        filt = alpha * (high[i] + low[i]) / 2. + (1. - alpha) * filt;
-        *frama++ = filt;
+    if (half_period < minmax_period) {
+        frama_run(size, high, low, period, w, progress, filt,
+            ptr->state.short_high, ptr->state.short_low, ptr->state.older_high, ptr->state.older_low, frama);
+    } else {
+        frama_run(size, high, low, period, w, progress, filt,
+            ptr->state.price_high, ptr->state.price_low, ptr->state.older_high, ptr->state.older_low, frama);
     }
 
     ptr->progress = progress;
     ptr->state.filt = filt;
 
-    ptr->state.max1 = max1;
-    ptr->state.max2 = max2;
-    ptr->state.min1 = min1;
-    ptr->state.min2 = min2;
-    ptr->state.max1_idx = max1_idx;
-    ptr->state.max2_idx = max2_idx;
-    ptr->state.min1_idx = min1_idx;
-    ptr->state.min2_idx = min2_idx;
-
     return TI_OKAY;
 }
@@ -9,6 +9,7 @@
 #include "../indicators.h"
 #include "../utils/log.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 struct {
     TI_REAL B0[20] = {0.828427,0.732051,0.618034,0.526602,0.455887,0.400720,0.356896,0.321416,0.292186,0.267730,0.246990,0.229192,0.213760,0.200256,0.188343,0.177759,0.168294,0.159780,0.152082,0.145089};
@@ -67,7 +68,7 @@ DONTOPTIMIZE int ti_gf1_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_gf1_stream : ti_stream {
+struct ti_gf1_stream : stream_base {
 
     struct {
         int period;
@@ -97,6 +98,7 @@ int ti_gf1_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_GF1_INDEX;
     ptr->progress = -ti_gf1_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -111,6 +113,8 @@ void ti_gf1_stream_free(ti_stream *stream) {
     delete static_cast<ti_gf1_stream*>(stream);
 }
 
+STREAM_IO(gf1, s.state)
+
 int ti_gf1_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_gf1_stream *ptr = static_cast<ti_gf1_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 struct {
     TI_REAL B0[20] = {0.834615,0.722959,0.578300,0.457577,0.365017,0.295336,0.242632,0.202250,0.170835,0.146017,0.126125,0.109966,0.096680,0.085633,0.076357,0.068496,0.061779,0.055996,0.050984,0.046612};
@@ -79,7 +80,7 @@ DONTOPTIMIZE int ti_gf2_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_gf2_stream : ti_stream {
+struct ti_gf2_stream : stream_base {
 
     struct {
         int period;
@@ -110,6 +111,7 @@ int ti_gf2_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_GF2_INDEX;
     ptr->progress = -ti_gf2_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -126,6 +128,8 @@ void ti_gf2_stream_free(ti_stream *stream) {
     delete static_cast<ti_gf2_stream*>(stream);
 }
 
+STREAM_IO(gf2, s.state)
+
 int ti_gf2_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_gf2_stream *ptr = static_cast<ti_gf2_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 struct {
     TI_REAL B0[20] = {0.836701,0.718670,0.558792,0.422292,0.318295,0.242068,0.186612,0.146016,0.115940,0.093340,0.076111,0.062791,0.052354,0.044075,0.037432,0.032045,0.027635,0.023991,0.020956,0.018409};
@@ -80,7 +81,7 @@ DONTOPTIMIZE int ti_gf3_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_gf3_stream : ti_stream {
+struct ti_gf3_stream : stream_base {
 
     struct {
         int period;
@@ -112,6 +113,7 @@ int ti_gf3_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_GF3_INDEX;
     ptr->progress = -ti_gf3_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -129,6 +131,8 @@ void ti_gf3_stream_free(ti_stream *stream) {
     delete static_cast<ti_gf3_stream*>(stream);
 }
 
+STREAM_IO(gf3, s.state)
+
 int ti_gf3_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_gf3_stream *ptr = static_cast<ti_gf3_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 struct {
     TI_REAL B0[20] = {0.837747,0.716200,0.547128,0.400596,0.289459,0.209659,0.153408,0.113779,0.085632,0.065397,0.050648,0.039744,0.031571,0.025363,0.020589,0.016875,0.013953,0.011632,0.009770,0.008263};
@@ -95,7 +96,7 @@ DONTOPTIMIZE int ti_gf4_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_gf4_stream : ti_stream {
+struct ti_gf4_stream : stream_base {
 
     struct {
         int period;
@@ -128,6 +129,7 @@ int ti_gf4_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_GF4_INDEX;
     ptr->progress = -ti_gf4_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -152,6 +154,8 @@ void ti_gf4_stream_free(ti_stream *stream) {
     delete static_cast<ti_gf4_stream*>(stream);
 }
 
+STREAM_IO(gf4, s.state)
+
 int ti_gf4_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_gf4_stream *ptr = static_cast<ti_gf4_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_hd_start(TI_REAL const *options) {
     return 5;
@@ -135,7 +136,7 @@ DONTOPTIMIZE int ti_hd_ref(int size, TI_REAL const *const *inputs, TI_REAL const
     return TI_OKAY;
 }
 
-struct ti_hd_stream : ti_stream {
+struct ti_hd_stream : stream_base {
 
     struct {
         
@@ -167,6 +168,7 @@ int ti_hd_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HD_INDEX;
     ptr->progress = -ti_hd_start(options);
+    ptr->keep_options(options);
 
     return TI_OKAY;
 }
@@ -175,6 +177,8 @@ void ti_hd_stream_free(ti_stream *stream) {
     delete static_cast<ti_hd_stream*>(stream);
 }
 
+STREAM_IO(hd, s.state)
+
 int ti_hd_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
 ti_hd_stream *ptr = static_cast<ti_hd_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -13,6 +13,8 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 
 int ti_hf_start(TI_REAL const *options) {
     const int k = options[0];
@@ -30,8 +32,7 @@ int ti_hf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     if (k < 1) { return TI_INVALID_OPTION; }
     if (threshold < 0) { return TI_INVALID_OPTION; }
 
-    std::multiset<TI_REAL> rankedprice;
-    std::vector<TI_REAL> a(2*k+1);
+    orderstat rankedprice(2*k+1);
 
     int i = 0;
     for (; i < 2*k && i < size; ++i) {
@@ -40,21 +41,14 @@ int ti_hf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     for (; i < size; ++i) {
         rankedprice.insert(series[i]);
 
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
+        TI_REAL median_price = rankedprice.select(k);
 
-        int j = 0;
-        for (TI_REAL price : rankedprice) {
-            a[j] = fabs(price - median_price);
-            ++j;
-        }
-
-        std::nth_element(a.begin(), a.begin()+k, a.end());
-        TI_REAL median_deviation = a[k];
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
 
         TI_REAL candidate = series[i];
         *hf++ = fabs(candidate - median_price) < threshold * 1.4826 * median_deviation ? candidate : median_price;
 
-        rankedprice.erase(rankedprice.find(series[i-2*k]));
+        rankedprice.erase(series[i-2*k]);
     }
 
     return TI_OKAY;
@@ -97,7 +91,7 @@ DONTOPTIMIZE int ti_hf_ref(int size, TI_REAL const *const *inputs, TI_REAL const
     return TI_OKAY;
 }
 
-struct ti_hf_stream : ti_stream {
+struct ti_hf_stream : stream_base {
 
     struct {
         int k;
@@ -106,8 +100,7 @@ struct ti_hf_stream : ti_stream {
 
     struct {
         ringbuf<0> price;
-        std::multiset<TI_REAL> rankedprice;
-        std::vector<TI_REAL> absbuf;
+        orderstat rankedprice;
     } state;
 
     struct {
@@ -128,12 +121,13 @@ int ti_hf_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HF_INDEX;
     ptr->progress = -ti_hf_start(options);
+    ptr->keep_options(options);
 
     ptr->options.k = k;
     ptr->options.threshold = threshold;
 
     ptr->state.price.resize(2*k+1);
-    ptr->state.absbuf.resize(2*k+1);
+    ptr->state.rankedprice.reserve(2*k+1);
 
     return TI_OKAY;
 }
@@ -142,6 +136,13 @@ void ti_hf_stream_free(ti_stream *stream) {
     delete static_cast<ti_hf_stream*>(stream);
 }
 
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_hf_stream &s) {
+    orderstat_refill(s.state.rankedprice, s.state.price, s.progress + 2*s.options.k);
+}
+
+STREAM_IO(hf, s.state.price)
+
 int ti_hf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_hf_stream *ptr = static_cast<ti_hf_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -152,7 +153,6 @@ int ti_hf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     auto &price = ptr->state.price;
     auto &rankedprice = ptr->state.rankedprice;
-    auto &absbuf = ptr->state.absbuf;
 
     int i = 0;
     for (; progress < 0 && i < size; ++i, ++progress, step(price)) {
@@ -163,21 +163,14 @@ int ti_hf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
         price = series[i];
         rankedprice.insert(series[i]);
 
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
-
-        int j = 0;
-        for (TI_REAL p : rankedprice) {
-            absbuf[j] = fabs(p - median_price);
-            ++j;
-        }
+        TI_REAL median_price = rankedprice.select(k);
 
-        std::nth_element(absbuf.begin(), absbuf.begin()+k, absbuf.end());
-        TI_REAL median_deviation = absbuf[k];
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
 
         TI_REAL candidate = series[i];
         *hf++ = fabs(candidate - median_price) < threshold * 1.4826 * median_deviation ? candidate : median_price;
 
-        rankedprice.erase(rankedprice.find(price[2*k]));;
+        rankedprice.erase(price[2*k]);
     }
 
     ptr->progress = progress;
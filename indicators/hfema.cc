@@ -11,6 +11,8 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_hfema_start(TI_REAL const *options) {
@@ -33,9 +35,8 @@ int ti_hfema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     if (threshold < 0) { return TI_INVALID_OPTION; }
 
     TI_REAL ema;
-    std::multiset<TI_REAL> rankedprice;
+    orderstat rankedprice(2*k+1);
     ringbuf<0> price(2*k+1);
-    std::vector<TI_REAL> a(2*k+1);
 
     int i = 0;
     for (; i < 1 && i < size; ++i, step(price)) {
@@ -53,18 +54,13 @@ int ti_hfema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
         price = ema;
         rankedprice.insert(price);
 
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
+        TI_REAL median_price = rankedprice.select(k);
         
-        int j = 0;
-        for (auto it = rankedprice.begin(); it != rankedprice.end(); ++it, ++j) {
-            a[j] = fabs(*it - median_price);
-        }
-        std::nth_element(a.begin(), a.begin()+k, a.end());
-        TI_REAL median_deviation = a[k];
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
         TI_REAL candidate = price[k];
         *hfema++ = fabs(candidate - median_price) <= threshold * 1.4826 * median_deviation ? candidate : median_price;
 
-        rankedprice.erase(rankedprice.find(price[2*k]));
+        rankedprice.erase(price[2*k]);
     }
 
     return TI_OKAY;
@@ -115,7 +111,7 @@ int ti_hfema_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_hfema_stream : ti_stream {
+struct ti_hfema_stream : stream_base {
 
     struct {
         int ema_period;
@@ -126,8 +122,7 @@ struct ti_hfema_stream : ti_stream {
     struct {
         TI_REAL ema;
         ringbuf<0> price;
-        std::multiset<TI_REAL> rankedprice;
-        std::vector<TI_REAL> a;
+        orderstat rankedprice;
     } state;
 
     struct {
@@ -150,13 +145,14 @@ int ti_hfema_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HFEMA_INDEX;
     ptr->progress = -ti_hfema_start(options);
+    ptr->keep_options(options);
 
     ptr->options.ema_period = ema_period;
     ptr->options.k = k;
     ptr->options.threshold = threshold;
 
     try {
-        ptr->state.a.resize(2*k+1);
+        ptr->state.rankedprice.reserve(2*k+1);
         ptr->state.price.resize(2*k+1);
     } catch (std::bad_alloc& e) {
         delete *stream;
@@ -170,6 +166,13 @@ void ti_hfema_stream_free(ti_stream *stream) {
     delete static_cast<ti_hfema_stream*>(stream);
 }
 
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_hfema_stream &s) {
+    orderstat_refill(s.state.rankedprice, s.state.price, s.progress + 2*s.options.k);
+}
+
+STREAM_IO(hfema, s.state.ema, s.state.price)
+
 int ti_hfema_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_hfema_stream *ptr = static_cast<ti_hfema_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -182,7 +185,6 @@ int ti_hfema_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
     TI_REAL ema = ptr->state.ema;
     auto &price = ptr->state.price;
     auto &rankedprice = ptr->state.rankedprice;
-    auto &a = ptr->state.a;
 
     int i = 0;
     for (; progress < -2*k+1 && i < size; ++i, ++progress, step(price)) {
@@ -199,17 +201,12 @@ int ti_hfema_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
         ema = (series[i] - ema) * 2. / (ema_period + 1.) + ema;
         price = ema;
         rankedprice.insert(ema);
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
-        int j = 0;
-        for (auto it = rankedprice.begin(); it != rankedprice.end(); ++it, ++j) {
-            a[j] = fabs(*it - median_price);
-        }
-        std::nth_element(a.begin(), a.begin()+k, a.end());
-        TI_REAL median_deviation = a[k];
+        TI_REAL median_price = rankedprice.select(k);
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
         TI_REAL candidate = price[k];
         *hfema++ = fabs(candidate - median_price) <= threshold * 1.4826 * median_deviation ? candidate : median_price;
 
-        rankedprice.erase(rankedprice.find(price[2*k]));
+        rankedprice.erase(price[2*k]);
     }
 
     ptr->progress = progress;
@@ -12,6 +12,8 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 
 int ti_hfsma_start(TI_REAL const *options) {
     int sma_period = options[0];
@@ -33,9 +35,8 @@ int ti_hfsma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     if (threshold < 0) { return TI_INVALID_OPTION; }
 
     TI_REAL sum = 0.;
-    std::multiset<TI_REAL> rankedprice;
+    orderstat rankedprice(2*k+1);
     ringbuf<0> smoothed_price(2*k+1);
-    std::vector<TI_REAL> a(2*k+1);
 
     int i = 0;
     for (; i < sma_period-1 && i < size; ++i, step(smoothed_price)) {
@@ -53,18 +54,13 @@ int ti_hfsma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
         rankedprice.insert(sum/sma_period);
         smoothed_price = sum/sma_period;
 
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
-        int j = 0;
-        for (auto it = rankedprice.begin(); it != rankedprice.end(); ++it, ++j) {
-            a[j] = fabs(*it - median_price);
-        }
-        std::nth_element(a.begin(), a.begin()+k, a.end());
-        TI_REAL median_deviation = a[k];
+        TI_REAL median_price = rankedprice.select(k);
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
         TI_REAL candidate = smoothed_price[k];
         *hfsma++ = fabs(candidate - median_price) <= threshold * 1.4826 * median_deviation ? candidate : median_price;
 
         sum -= series[i-sma_period+1];
-        rankedprice.erase(rankedprice.find(smoothed_price[2*k]));
+        rankedprice.erase(smoothed_price[2*k]);
     }
 
     return TI_OKAY;
@@ -111,7 +107,7 @@ int ti_hfsma_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_hfsma_stream : ti_stream {
+struct ti_hfsma_stream : stream_base {
 
     struct {
         int sma_period;
@@ -121,10 +117,9 @@ struct ti_hfsma_stream : ti_stream {
 
     struct {
         TI_REAL sum;
-        std::multiset<TI_REAL> rankedprice;
+        orderstat rankedprice;
         ringbuf<0> price;
         ringbuf<0> smoothed_price;
-        std::vector<TI_REAL> a;
     } state;
 
     struct {
@@ -147,6 +142,7 @@ int ti_hfsma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HFSMA_INDEX;
     ptr->progress = -ti_hfsma_start(options);
+    ptr->keep_options(options);
 
     ptr->state.sum = 0.;
 
@@ -155,7 +151,7 @@ int ti_hfsma_stream_new(TI_REAL const *options, ti_stream **stream) {
     ptr->options.threshold = threshold;
 
     try {
-        ptr->state.a.resize(2*k+1);
+        ptr->state.rankedprice.reserve(2*k+1);
         ptr->state.price.resize(2*k+1);
         ptr->state.smoothed_price.resize(2*k+1);
     } catch (std::bad_alloc& e) {
@@ -170,6 +166,13 @@ void ti_hfsma_stream_free(ti_stream *stream) {
     delete static_cast<ti_hfsma_stream*>(stream);
 }
 
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_hfsma_stream &s) {
+    orderstat_refill(s.state.rankedprice, s.state.smoothed_price, s.progress + 2*s.options.k);
+}
+
+STREAM_IO(hfsma, s.state.sum, s.state.price, s.state.smoothed_price)
+
 int ti_hfsma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_hfsma_stream *ptr = static_cast<ti_hfsma_stream*>(stream);
     const TI_REAL *const series = inputs[0];
@@ -180,10 +183,9 @@ int ti_hfsma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
     TI_REAL threshold = ptr->options.threshold;
 
     TI_REAL sum = ptr->state.sum;
-    std::multiset<TI_REAL> &rankedprice = ptr->state.rankedprice;
+    auto &rankedprice = ptr->state.rankedprice;
     auto &price = ptr->state.price;
     auto &smoothed_price = ptr->state.smoothed_price;
-    auto &a = ptr->state.a;
 
     int i = 0;
 
@@ -204,18 +206,13 @@ int ti_hfsma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
         sum += series[i];
         smoothed_price = sum/sma_period;
         rankedprice.insert(sum/sma_period);
-        TI_REAL median_price = *std::next(rankedprice.begin(), k);
-        int j = 0;
-        for (auto it = rankedprice.begin(); it != rankedprice.end(); ++it, ++j) {
-            a[j] = fabs(*it - median_price);
-        }
-        std::nth_element(a.begin(), a.begin()+k, a.end());
-        TI_REAL median_deviation = a[k];
+        TI_REAL median_price = rankedprice.select(k);
+        TI_REAL median_deviation = rankedprice.select_deviation(k, k);
         TI_REAL candidate = smoothed_price[k];
         *hfsma++ = fabs(candidate - median_price) <= threshold * 1.4826 * median_deviation ? candidate : median_price;
 
         sum -= price[sma_period-1];
-        rankedprice.erase(rankedprice.find(smoothed_price[2*k]));
+        rankedprice.erase(smoothed_price[2*k]);
     }
 
     ptr->progress = progress;
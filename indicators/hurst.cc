@@ -10,8 +10,10 @@
 
 #include "../indicators.h"
 #include "../utils/log.h"
-#include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/hull.hh"
+#include "../utils/moments.hh"
+#include "../utils/stream.hh"
 
 int ti_hurst_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -19,6 +21,53 @@ int ti_hurst_start(TI_REAL const *options) {
     return period;
 }
 
+/* The cumulative deviation from the mean of the window of returns ending at k,
+ * sum_{q<=j} (r_{k-q} - mean), is (P_k - k*mean) - (P_m - m*mean) with m = k-j-1
+ * and P the prefix sums of the returns, so its range over j is the range of
+ * P_m - mean*m over the points (m, P_m), m in [k-period, k-1]: two line queries
+ * against the hull of these points. The mean and the variance slide along with
+ * them as rolling_moments.
+ */
+
+static void hurst_value(sliding_hull const &hull, rolling_moments const &moments, TI_REAL period, TI_REAL *hurst, TI_REAL *fractal_dim) {
+    const TI_REAL mean = moments.mean;
+
+    const sliding_hull::point hi = hull.argmax(mean), lo = hull.argmin(mean);
+    TI_REAL R = (hi.y - lo.y) - mean * (hi.x - lo.x);
+    TI_REAL S = sqrt(moments.var(1. / period));
+
+    TI_REAL H = R ? log(R/S) / log(period) : 0;
+    *hurst = H;
+    *fractal_dim = 2 - H;
+}
+
+/* The windows shorter than this are cheaper to rescan directly */
+static const int hull_period = 64;
+
+static void hurst_scan(ringbuf<0> const &r, TI_REAL sum, TI_REAL period, TI_REAL *hurst, TI_REAL *fractal_dim) {
+    TI_REAL mean = sum / period;
+
+    TI_REAL cum_meandev = 0;
+    TI_REAL max_cum_meandev = -std::numeric_limits<TI_REAL>::infinity();
+    TI_REAL min_cum_meandev = std::numeric_limits<TI_REAL>::infinity();
+    TI_REAL stddev = 0;
+    for (int j = 0; j < period; ++j) {
+        cum_meandev += r[j] - mean;
+        max_cum_meandev = std::max(max_cum_meandev, cum_meandev);
+        min_cum_meandev = std::min(min_cum_meandev, cum_meandev);
+        stddev += pow(r[j] - mean, 2);
+    }
+    stddev /= period;
+    stddev = sqrt(stddev);
+
+    TI_REAL R = max_cum_meandev - min_cum_meandev;
+    TI_REAL S = stddev;
+
+    TI_REAL H = R ? log(R/S) / log(period) : 0;
+    *hurst = H;
+    *fractal_dim = 2 - H;
+}
+
 int ti_hurst(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
     TI_REAL const *const series = inputs[0];
     const TI_REAL period = options[0];
@@ -28,40 +77,55 @@ int ti_hurst(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     if (period < 2) { return TI_INVALID_OPTION; }
 
     ringbuf<0> r(period);
-    TI_REAL sum = 0;
+
+    if (period < hull_period) {
+        TI_REAL sum = 0;
+
+        int i = 1;
+        for (; i < period && i < size; ++i, step(r)) {
+            r = series[i] && series[i-1] ? log(series[i] / series[i-1]) : 0;
+            sum += r;
+        }
+        for (; i < size; ++i, step(r)) {
+            r = series[i] && series[i-1] ? log(series[i] / series[i-1]) : 0;
+            sum += r;
+
+            hurst_scan(r, sum, period, hurst++, fractal_dim++);
+
+            sum -= r[period-1];
+        }
+
+        return TI_OKAY;
+    }
+
+    sliding_hull hull;
+    hull.reserve(period + 1);
+    const TI_REAL per = 1. / period;
+    rolling_moments moments;
+    TI_REAL prefix = 0;
+    int refresh = 1; /* the first full window */
 
     int i = 1;
     for (; i < period && i < size; ++i, step(r)) {
         r = series[i] && series[i-1] ? log(series[i] / series[i-1]) : 0;
-        sum += r;
+        hull.push(i-1, prefix);
+        prefix += r;
     }
     for (; i < size; ++i, step(r)) {
+        const TI_REAL oldest = r;
         r = series[i] && series[i-1] ? log(series[i] / series[i-1]) : 0;
-        sum += r;
-
-        TI_REAL mean = sum / period;
-
-        TI_REAL cum_meandev = 0;
-        TI_REAL max_cum_meandev = -std::numeric_limits<TI_REAL>::infinity();
-        TI_REAL min_cum_meandev = std::numeric_limits<TI_REAL>::infinity();
-        TI_REAL stddev = 0;
-        for (int j = 0; j < period; ++j) {
-            cum_meandev += r[j] - mean;
-            max_cum_meandev = std::max(max_cum_meandev, cum_meandev);
-            min_cum_meandev = std::min(min_cum_meandev, cum_meandev);
-            stddev += pow(r[j] - mean, 2);
+        hull.push(i-1, prefix);
+        prefix += r;
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(r, period, per);
+        } else {
+            moments.slide(r, oldest, per);
         }
-        stddev /= period;
-        stddev = sqrt(stddev);
 
-        TI_REAL R = max_cum_meandev - min_cum_meandev;
-        TI_REAL S = stddev;
+        hurst_value(hull, moments, period, hurst++, fractal_dim++);
 
-        TI_REAL H = R ? log(R/S) / log(period) : 0;
-        *hurst++ = H;
-        *fractal_dim++ = 2 - H;
-
-        sum -= r[period-1];
+        hull.pop();
     }
 
     return TI_OKAY;
@@ -116,7 +180,7 @@ int ti_hurst_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_hurst_stream : ti_stream {
+struct ti_hurst_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -125,7 +189,12 @@ struct ti_hurst_stream : ti_stream {
     struct {
         ringbuf<0> r;
         ringbuf<2> price;
-        TI_REAL sum = 0;
+        TI_REAL sum = 0; /* below hull_period */
+        rolling_moments moments;
+        TI_REAL prefix = 0;
+        int t = 0;
+        int refresh;
+        sliding_hull hull;
     } state;
 
     struct {
@@ -144,11 +213,14 @@ int ti_hurst_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HURST_INDEX;
     ptr->progress = -ti_hurst_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
+    ptr->state.refresh = 1; /* the first full window */
 
     try {
         ptr->state.r.resize(period);
+        if (period >= hull_period) { ptr->state.hull.reserve(period + 1); }
     } catch (std::bad_alloc& e) {
         delete ptr;
         return TI_OUT_OF_MEMORY;
@@ -161,6 +233,10 @@ void ti_hurst_stream_free(ti_stream *stream) {
     delete static_cast<ti_hurst_stream*>(stream);
 }
 
+STREAM_IO(hurst,
+    s.state.r, s.state.price, s.state.sum, s.state.moments, s.state.prefix, s.state.t, s.state.refresh,
+    s.state.hull)
+
 int ti_hurst_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_hurst_stream *ptr = static_cast<ti_hurst_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -171,51 +247,75 @@ int ti_hurst_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
 
     auto &r = ptr->state.r;
     auto &price = ptr->state.price;
-    TI_REAL sum = ptr->state.sum;
+    auto &hull = ptr->state.hull;
+    const TI_REAL per = 1. / period;
+    rolling_moments moments = ptr->state.moments;
+    TI_REAL prefix = ptr->state.prefix;
+    int t = ptr->state.t;
+    int refresh = ptr->state.refresh;
 
     int i = 0;
     for (; progress < -period+1 && i < size; ++i, ++progress, step(price)) {
         price = series[i];
     }
-    for (; progress < 0 && i < size; ++i, ++progress, step(price, r)) {
+
+    if (period < hull_period) {
+        TI_REAL sum = ptr->state.sum;
+
+        for (; progress < 0 && i < size; ++i, ++progress, step(price, r)) {
+            price = series[i];
+
+            r = price && price[1] ? log(price / price[1]) : 0;
+            sum += r;
+        }
+        for (; i < size; ++i, ++progress, step(price, r)) {
+            price = series[i];
+
+            r = price && price[1] ? log(price / price[1]) : 0;
+            sum += r;
+
+            hurst_scan(r, sum, period, hurst++, fractal_dim++);
+
+            sum -= r[period-1];
+        }
+
+        ptr->progress = progress;
+        ptr->state.sum = sum;
+
+        return TI_OKAY;
+    }
+
+    for (; progress < 0 && i < size; ++i, ++progress, ++t, step(price, r)) {
         price = series[i];
 
         r = price && price[1] ? log(price / price[1]) : 0;
-        sum += r;
+        hull.push(t, prefix);
+        prefix += r;
     }
-    for (; i < size; ++i, ++progress, step(price, r)) {
+    for (; i < size; ++i, ++progress, ++t, step(price, r)) {
         price = series[i];
 
+        const TI_REAL oldest = r;
         r = price && price[1] ? log(price / price[1]) : 0;
-        sum += r;
-
-        TI_REAL mean = sum / period;
-
-        TI_REAL cum_meandev = 0;
-        TI_REAL max_cum_meandev = -std::numeric_limits<TI_REAL>::infinity();
-        TI_REAL min_cum_meandev = std::numeric_limits<TI_REAL>::infinity();
-        TI_REAL stddev = 0;
-        for (int j = 0; j < period; ++j) {
-            cum_meandev += r[j] - mean;
-            max_cum_meandev = std::max(max_cum_meandev, cum_meandev);
-            min_cum_meandev = std::min(min_cum_meandev, cum_meandev);
-            stddev += pow(r[j] - mean, 2);
+        hull.push(t, prefix);
+        prefix += r;
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(r, period, per);
+        } else {
+            moments.slide(r, oldest, per);
         }
-        stddev /= period;
-        stddev = sqrt(stddev);
-
-        TI_REAL R = max_cum_meandev - min_cum_meandev;
-        TI_REAL S = stddev;
 
-        TI_REAL H = R ? log(R/S) / log(period) : 0;
-        *hurst++ = H;
-        *fractal_dim++ = 2 - H;
+        hurst_value(hull, moments, period, hurst++, fractal_dim++);
 
-        sum -= r[period-1];
+        hull.pop();
     }
 
     ptr->progress = progress;
-    ptr->state.sum = sum;
+    ptr->state.moments = moments;
+    ptr->state.prefix = prefix;
+    ptr->state.t = t;
+    ptr->state.refresh = refresh;
 
     return TI_OKAY;
 }
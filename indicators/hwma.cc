@@ -10,6 +10,8 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/fir.hh"
+#include "../utils/stream.hh"
 
 int ti_hwma_start(TI_REAL const *options) {
     const int period = options[0];
@@ -34,18 +36,17 @@ int ti_hwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     const int period = options[0];
     TI_REAL *hwma = outputs[0];
 
-    auto &c = tables.coefficients[period-7];
-
     if (period < 7 || period > 13) { return TI_INVALID_OPTION; }
 
-    for (int i = period-1; i < size; ++i) {
-        TI_REAL filt = 0;
-        for (int j = 0; j < period; ++j) {
-            filt += c[12-j] * series[i-j];
-        }
-        *hwma++ = filt;
+    auto &c = tables.coefficients[period-7];
+
+    TI_REAL weights[13];
+    for (int j = 0; j < period; ++j) {
+        weights[j] = c[12-j];
     }
 
+    fir_run(weights, period, 1, series, size, hwma);
+
     return TI_OKAY;
 }
 
@@ -69,7 +70,7 @@ DONTOPTIMIZE int ti_hwma_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_hwma_stream : ti_stream {
+struct ti_hwma_stream : stream_base {
 
     struct {
         int period;
@@ -96,6 +97,7 @@ int ti_hwma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_HWMA_INDEX;
     ptr->progress = -ti_hwma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -106,6 +108,8 @@ void ti_hwma_stream_free(ti_stream *stream) {
     delete static_cast<ti_hwma_stream*>(stream);
 }
 
+STREAM_IO(hwma, s.state)
+
 int ti_hwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_hwma_stream *ptr = static_cast<ti_hwma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
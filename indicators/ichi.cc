@@ -12,6 +12,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_ichi_start(TI_REAL const *options) {
     const int period9 = options[0];
@@ -240,7 +241,7 @@ DONTOPTIMIZE int ti_ichi_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_ichi_stream : ti_stream {
+struct ti_ichi_stream : stream_base {
 
     struct {
         int period9;
@@ -269,8 +270,8 @@ struct ti_ichi_stream : ti_stream {
         ringbuf<0> buf_ichi_senkou_span_A;
         ringbuf<0> buf_ichi_senkou_span_B;
 
-        ringbuf<0> price_high;
-        ringbuf<0> price_low;
+        ringbuf_minmax<0> price_high;
+        ringbuf_minmax<0> price_low;
     } state;
 
     struct {
@@ -293,6 +294,7 @@ int ti_ichi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_ICHI_INDEX;
     ptr->progress = -ti_ichi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period9 = period9;
     ptr->options.period26 = period26;
@@ -315,6 +317,12 @@ void ti_ichi_stream_free(ti_stream *stream) {
     delete static_cast<ti_ichi_stream*>(stream);
 }
 
+STREAM_IO(ichi,
+    s.state.hh9, s.state.ll9, s.state.hh9_idx, s.state.ll9_idx, s.state.hh26, s.state.ll26,
+    s.state.hh26_idx, s.state.ll26_idx, s.state.hh52, s.state.ll52, s.state.hh52_idx,
+    s.state.ll52_idx, s.state.buf_ichi_senkou_span_A, s.state.buf_ichi_senkou_span_B,
+    s.state.price_high, s.state.price_low)
+
 int ti_ichi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_ichi_stream *ptr = static_cast<ti_ichi_stream*>(stream);
     TI_REAL const *const high = inputs[0];
@@ -11,6 +11,8 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/fir.hh"
+#include "../utils/stream.hh"
 
 int ti_idwma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -36,13 +38,7 @@ int ti_idwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
         denom += coefficients[i];
     }
 
-    for (int i = period-1; i < size; ++i) {
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            numer += series[i-j] * coefficients[j];
-        }
-        *idwma++ = numer / denom;
-    }
+    fir_run(coefficients.data(), period, 1. / denom, series, size, idwma);
 
     return TI_OKAY;
 }
@@ -73,7 +69,7 @@ DONTOPTIMIZE int ti_idwma_ref(int size, TI_REAL const *const *inputs, TI_REAL co
     return TI_OKAY;
 }
 
-struct ti_idwma_stream : ti_stream {
+struct ti_idwma_stream : stream_base {
 
     struct {
         int period;
@@ -104,6 +100,7 @@ int ti_idwma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_IDWMA_INDEX;
     ptr->progress = -ti_idwma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.exponent = exponent;
@@ -125,6 +122,8 @@ void ti_idwma_stream_free(ti_stream *stream) {
     delete static_cast<ti_idwma_stream*>(stream);
 }
 
+STREAM_IO(idwma, s.state.price)
+
 int ti_idwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_idwma_stream *ptr = static_cast<ti_idwma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -145,12 +144,7 @@ int ti_idwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
     }
     for (; i < size; ++i, ++progress, step(price)) {
         price = series[i];
-        
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            numer += price[j] * coefficients[j];
-        }
-        *idwma++ = numer / denom;
+        *idwma++ = fir_dot(coefficients.data(), period, price) / denom;
     }
 
     ptr->progress = progress;
@@ -5,10 +5,12 @@
 
 
 #include <new>
+#include <vector>
 #include <algorithm>
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_kc_start(TI_REAL const *options) {
@@ -69,7 +71,7 @@ int ti_kc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
 /// 1. close used instead of a generic input
 /// 2. no ref since atr's ema and plain ema do not agree in the start amount, the plain ema way is chosen
 
-struct ti_kc_stream : ti_stream {
+struct ti_kc_stream : stream_base {
     struct {
         TI_REAL period;
         TI_REAL multiple;
@@ -90,7 +92,7 @@ int ti_kc_stream_new(TI_REAL const *options, ti_stream **stream) {
     const TI_REAL period = options[0];
     const TI_REAL multiple = options[1];
 
-    if (period < 0) { return TI_INVALID_OPTION; }
+    if (period < 1) { return TI_INVALID_OPTION; }
     if (multiple < 0) { return TI_INVALID_OPTION; }
 
     ti_kc_stream *ptr = new ti_kc_stream();
@@ -99,6 +101,7 @@ int ti_kc_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_KC_INDEX;
     ptr->progress = -ti_kc_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.multiple = multiple;
@@ -112,6 +115,8 @@ void ti_kc_stream_free(ti_stream *stream) {
     delete static_cast<ti_kc_stream*>(stream);
 }
 
+STREAM_IO(kc, s.state)
+
 int ti_kc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_kc_stream *ptr = static_cast<ti_kc_stream*>(stream);
 
@@ -163,3 +168,133 @@ int ti_kc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     return TI_OKAY;
 }
+
+int ti_kc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_kc_stream const *ptr = static_cast<ti_kc_stream const*>(stream);
+
+    const TI_REAL multiple = ptr->options.multiple;
+    const TI_REAL per = ptr->constants.per;
+
+    const TI_REAL high = inputs[0][0];
+    const TI_REAL low = inputs[1][0];
+    const TI_REAL close = inputs[2][0];
+
+    TI_REAL price_ema, tr_ema;
+    if (ptr->progress < 1) {
+        price_ema = close;
+        tr_ema = high - low;
+    } else {
+        const TI_REAL prev_close = ptr->state.prev_close;
+        price_ema = (close - ptr->state.price_ema) * per + ptr->state.price_ema;
+
+        const TI_REAL truerange = std::max(high, prev_close) - std::min(low, prev_close);
+        tr_ema = (truerange - ptr->state.tr_ema) * per + ptr->state.tr_ema;
+    }
+
+    outputs[0][0] = price_ema - multiple * tr_ema;
+    outputs[1][0] = price_ema;
+    outputs[2][0] = price_ema + multiple * tr_ema;
+
+    return TI_OKAY;
+}
+
+
+struct ti_kc_batch : ti_batch {
+    struct {
+        TI_REAL period;
+        TI_REAL multiple;
+    } options;
+
+    struct {
+        std::vector<TI_REAL> price_ema;
+        std::vector<TI_REAL> tr_ema;
+        std::vector<TI_REAL> prev_close;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+int ti_kc_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch) {
+    const TI_REAL period = options[0];
+    const TI_REAL multiple = options[1];
+
+    if (period < 1) { return TI_INVALID_OPTION; }
+    if (multiple < 0) { return TI_INVALID_OPTION; }
+    if (nsymbols < 1) { return TI_INVALID_OPTION; }
+
+    ti_kc_batch *ptr = new(std::nothrow) ti_kc_batch();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *batch = ptr;
+
+    ptr->index = TI_INDICATOR_KC_INDEX;
+    ptr->progress = -ti_kc_start(options);
+    ptr->nsymbols = nsymbols;
+
+    ptr->options.period = period;
+    ptr->options.multiple = multiple;
+
+    ptr->constants.per = 2. / (period + 1.);
+
+    try {
+        ptr->state.price_ema.resize(nsymbols);
+        ptr->state.tr_ema.resize(nsymbols);
+        ptr->state.prev_close.resize(nsymbols);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_kc_batch_free(ti_batch *batch) {
+    delete static_cast<ti_kc_batch*>(batch);
+}
+
+int ti_kc_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_kc_batch *ptr = static_cast<ti_kc_batch*>(batch);
+    const int nsymbols = ptr->nsymbols;
+    const int progress = ptr->progress;
+    const TI_REAL multiple = ptr->options.multiple;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *kc_lower = outputs[0];
+    TI_REAL *kc_middle = outputs[1];
+    TI_REAL *kc_upper = outputs[2];
+
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL *const price_ema = ptr->state.price_ema.data();
+    TI_REAL *const tr_ema = ptr->state.tr_ema.data();
+    TI_REAL *const prev_close = ptr->state.prev_close.data();
+
+    if (progress < 1) {
+        for (int s = 0; s < nsymbols; ++s) {
+            price_ema[s] = close[s];
+            tr_ema[s] = high[s] - low[s];
+        }
+    } else {
+        for (int s = 0; s < nsymbols; ++s) {
+            price_ema[s] = (close[s] - price_ema[s]) * per + price_ema[s];
+
+            const TI_REAL truerange = std::max(high[s], prev_close[s]) - std::min(low[s], prev_close[s]);
+            tr_ema[s] = (truerange - tr_ema[s]) * per + tr_ema[s];
+        }
+    }
+    if (progress >= 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            kc_lower[s] = price_ema[s] - multiple * tr_ema[s];
+            kc_middle[s] = price_ema[s];
+            kc_upper[s] = price_ema[s] + multiple * tr_ema[s];
+        }
+    }
+    std::copy(close, close + nsymbols, prev_close);
+
+    ptr->progress = progress + 1;
+
+    return TI_OKAY;
+}
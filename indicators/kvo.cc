@@ -8,6 +8,7 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_kvo_start(TI_REAL const *options) {
@@ -74,3 +75,124 @@ int ti_kvo(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
 
     return TI_OKAY;
 }
+
+
+struct ti_kvo_stream : stream_base {
+    struct {
+        int short_period;
+        int long_period;
+    } options;
+
+    struct {
+        TI_REAL cm;
+        TI_REAL prev_hlc;
+        TI_REAL prev_dm;
+        int trend;
+        TI_REAL short_ema;
+        TI_REAL long_ema;
+    } state;
+
+    struct {
+        TI_REAL short_per;
+        TI_REAL long_per;
+    } constants;
+};
+
+
+int ti_kvo_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int long_period = (int)options[1];
+
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (long_period < short_period) return TI_INVALID_OPTION;
+
+    ti_kvo_stream *ptr = new(std::nothrow) ti_kvo_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_KVO_INDEX;
+    ptr->progress = -ti_kvo_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.long_period = long_period;
+
+    ptr->state.trend = -1;
+
+    ptr->constants.short_per = 2 / ((TI_REAL)short_period + 1);
+    ptr->constants.long_per = 2 / ((TI_REAL)long_period + 1);
+
+    return TI_OKAY;
+}
+
+void ti_kvo_stream_free(ti_stream *stream) {
+    delete static_cast<ti_kvo_stream*>(stream);
+}
+
+STREAM_IO(kvo, s.state)
+
+int ti_kvo_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_kvo_stream *ptr = static_cast<ti_kvo_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    const TI_REAL *volume = inputs[3];
+    TI_REAL *output = outputs[0];
+
+    const TI_REAL short_per = ptr->constants.short_per;
+    const TI_REAL long_per = ptr->constants.long_per;
+
+    TI_REAL cm = ptr->state.cm;
+    TI_REAL prev_hlc = ptr->state.prev_hlc;
+    TI_REAL prev_dm = ptr->state.prev_dm;
+    int trend = ptr->state.trend;
+    TI_REAL short_ema = ptr->state.short_ema;
+    TI_REAL long_ema = ptr->state.long_ema;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        prev_hlc = high[i] + low[i] + close[i];
+        prev_dm = high[i] - low[i];
+    }
+    for (; i < size; ++i, ++progress) {
+        const TI_REAL hlc = high[i] + low[i] + close[i];
+        const TI_REAL dm = high[i] - low[i];
+
+        if (hlc > prev_hlc && trend != 1) {
+            trend = 1;
+            cm = prev_dm;
+        } else if (hlc < prev_hlc && trend != 0) {
+            trend = 0;
+            cm = prev_dm;
+        }
+
+        cm += dm;
+
+        const TI_REAL vf = dm ? volume[i] * fabs(dm / cm * 2 - 1) * 100 * (trend ? 1.0 : -1.0) : 0;
+
+        if (progress == 0) {
+            short_ema = vf;
+            long_ema = vf;
+        } else {
+            short_ema = (vf-short_ema) * short_per + short_ema;
+            long_ema = (vf-long_ema) * long_per + long_ema;
+        }
+
+        *output++ = short_ema - long_ema;
+
+        prev_hlc = hlc;
+        prev_dm = dm;
+    }
+
+    ptr->progress = progress;
+    ptr->state.cm = cm;
+    ptr->state.prev_hlc = prev_hlc;
+    ptr->state.prev_dm = prev_dm;
+    ptr->state.trend = trend;
+    ptr->state.short_ema = short_ema;
+    ptr->state.long_ema = long_ema;
+
+    return TI_OKAY;
+}
@@ -5,10 +5,12 @@
 
 
 #include <new>
+#include <vector>
 
 #include "../indicators.h"
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_lf_start(TI_REAL const *options) {
     TI_REAL gamma = options[0];
@@ -46,7 +48,7 @@ int ti_lf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     return TI_OKAY;
 }
 
-struct ti_lf_stream : ti_stream {
+struct ti_lf_stream : stream_base {
 
     struct {
         TI_REAL gamma;
@@ -75,6 +77,7 @@ int ti_lf_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_LF_INDEX;
     ptr->progress = -ti_lf_start(options);
+    ptr->keep_options(options);
 
     ptr->options.gamma = gamma;
 
@@ -85,6 +88,8 @@ void ti_lf_stream_free(ti_stream *stream) {
     delete static_cast<ti_lf_stream*>(stream);
 }
 
+STREAM_IO(lf, s.state)
+
 int ti_lf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_lf_stream *ptr = static_cast<ti_lf_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -120,3 +125,86 @@ int ti_lf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     return TI_OKAY;
 }
+
+
+struct ti_lf_batch : ti_batch {
+
+    struct {
+        TI_REAL gamma;
+    } options;
+
+    struct {
+        std::vector<TI_REAL> L0;
+        std::vector<TI_REAL> L1;
+        std::vector<TI_REAL> L2;
+        std::vector<TI_REAL> L3;
+    } state;
+
+    struct {
+
+    } constants;
+};
+
+int ti_lf_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch) {
+    TI_REAL gamma = options[0];
+
+    if (gamma < 0) { return TI_INVALID_OPTION; }
+    if (nsymbols < 1) { return TI_INVALID_OPTION; }
+
+    ti_lf_batch *ptr = new(std::nothrow) ti_lf_batch();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *batch = ptr;
+
+    ptr->index = TI_INDICATOR_LF_INDEX;
+    ptr->progress = -ti_lf_start(options);
+    ptr->nsymbols = nsymbols;
+
+    ptr->options.gamma = gamma;
+
+    try {
+        ptr->state.L0.resize(nsymbols);
+        ptr->state.L1.resize(nsymbols);
+        ptr->state.L2.resize(nsymbols);
+        ptr->state.L3.resize(nsymbols);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_lf_batch_free(ti_batch *batch) {
+    delete static_cast<ti_lf_batch*>(batch);
+}
+
+int ti_lf_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_lf_batch *ptr = static_cast<ti_lf_batch*>(batch);
+    const int nsymbols = ptr->nsymbols;
+    TI_REAL const *const series = inputs[0];
+    TI_REAL *lf = outputs[0];
+    TI_REAL gamma = ptr->options.gamma;
+
+    TI_REAL *const L0 = ptr->state.L0.data();
+    TI_REAL *const L1 = ptr->state.L1.data();
+    TI_REAL *const L2 = ptr->state.L2.data();
+    TI_REAL *const L3 = ptr->state.L3.data();
+
+    for (int s = 0; s < nsymbols; ++s) {
+        TI_REAL L0_new = (1. - gamma) * series[s] + gamma*L0[s];
+        TI_REAL L1_new = -gamma*L0_new + L0[s] + gamma*L1[s];
+        TI_REAL L2_new = -gamma*L1_new + L1[s] + gamma*L2[s];
+        TI_REAL L3_new = -gamma*L2_new + L2[s] + gamma*L3[s];
+
+        L0[s] = L0_new;
+        L1[s] = L1_new;
+        L2[s] = L2_new;
+        L3[s] = L3_new;
+
+        lf[s] = (L0_new + 2.*L1_new + 2.*L2_new + L3_new) / 6.;
+    }
+
+    ptr->progress += 1;
+
+    return TI_OKAY;
+}
@@ -5,8 +5,13 @@
  */
 
 
+#include <new>
+#include <vector>
+
 #include "../indicators.h"
 #include "trend.h"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
 
 
 int ti_linreg_start(TI_REAL const *options) {
@@ -27,3 +32,54 @@ int ti_linreg(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     assert(output - outputs[0] == size - ti_linreg_start(options));
     return TI_OKAY;
 }
+
+
+int ti_linreg_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_linreg, 1, size, inputs, options, ti_linreg_start(options), first_output, count, outputs);
+}
+
+int ti_linreg_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    /* linreg(x - shift) == linreg(x) - shift */
+    const TI_REAL shift = input[0];
+    std::vector<TI_REAL> sum(size+1);
+    prefix_sum(size, input, shift, sum.data(), [](int, TI_REAL x) { return x; });
+
+    for (int p = 0; p < nparams; ++p) {
+        const int period = (int)multi_options(options, 1, p)[0];
+        if (size < period) { continue; }
+        TI_REAL *output = multi_output(outputs, 0, size, p);
+
+        const TI_REAL per = 1.0 / period;
+        const TI_REAL x = period * (period+1) / 2.; /* Sum of Xs. */
+        const TI_REAL x2 = period * (period+1) * (2*period+1) / 6.; /* Sum of square of Xs. */
+        const TI_REAL bd = 1.0 / (period * x2 - x * x);
+
+        /* The weighted sum is carried over as in ti_linreg, the flat one comes from the prefix sums. */
+        TI_REAL xy = 0;
+        for (int i = 0; i < period-1; ++i) {
+            xy += (input[i] - shift) * (i+1);
+        }
+
+        for (int i = period-1; i < size; ++i) {
+            xy += (input[i] - shift) * period;
+            const TI_REAL y = sum[i+1] - sum[i+1-period];
+
+            const TI_REAL b = (period * xy - x * y) * bd;
+            const TI_REAL a = (y - b * x) * per;
+            *output++ = a + b * period + shift;
+
+            xy -= y;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_lma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -77,7 +78,7 @@ DONTOPTIMIZE int ti_lma_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_lma_stream : ti_stream {
+struct ti_lma_stream : stream_base {
 
     struct {
         int period;
@@ -106,6 +107,7 @@ int ti_lma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_LMA_INDEX;
     ptr->progress = -ti_lma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -126,6 +128,8 @@ void ti_lma_stream_free(ti_stream *stream) {
     delete static_cast<ti_lma_stream*>(stream);
 }
 
+STREAM_IO(lma, s.state.wsum_price, s.state.sum_price, s.state.price)
+
 int ti_lma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_lma_stream *ptr = static_cast<ti_lma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_macd_start(TI_REAL const *options) {
@@ -72,3 +75,144 @@ int ti_macd(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(hist - outputs[2] == size - ti_macd_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_macd_stream : stream_base {
+    struct {
+        int short_period;
+        int long_period;
+        int signal_period;
+    } options;
+
+    struct {
+        TI_REAL short_ema;
+        TI_REAL long_ema;
+        TI_REAL signal_ema;
+    } state;
+
+    struct {
+        TI_REAL short_per;
+        TI_REAL long_per;
+        TI_REAL signal_per;
+    } constants;
+};
+
+
+int ti_macd_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int long_period = (int)options[1];
+    const int signal_period = (int)options[2];
+
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (long_period < 2) return TI_INVALID_OPTION;
+    if (long_period < short_period) return TI_INVALID_OPTION;
+    if (signal_period < 1) return TI_INVALID_OPTION;
+
+    ti_macd_stream *ptr = new(std::nothrow) ti_macd_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MACD_INDEX;
+    ptr->progress = -ti_macd_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.long_period = long_period;
+    ptr->options.signal_period = signal_period;
+
+    ptr->constants.short_per = 2 / ((TI_REAL)short_period + 1);
+    ptr->constants.long_per = 2 / ((TI_REAL)long_period + 1);
+    ptr->constants.signal_per = 2 / ((TI_REAL)signal_period + 1);
+
+    if (short_period == 12 && long_period == 26) {
+        /* as in ti_macd */
+        ptr->constants.short_per = 0.15;
+        ptr->constants.long_per = 0.075;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_macd_stream_free(ti_stream *stream) {
+    delete static_cast<ti_macd_stream*>(stream);
+}
+
+STREAM_IO(macd, s.state)
+
+int ti_macd_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_macd_stream *ptr = static_cast<ti_macd_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *macd = outputs[0];
+    TI_REAL *signal = outputs[1];
+    TI_REAL *hist = outputs[2];
+
+    const int long_period = ptr->options.long_period;
+    const TI_REAL short_per = ptr->constants.short_per;
+    const TI_REAL long_per = ptr->constants.long_per;
+    const TI_REAL signal_per = ptr->constants.signal_per;
+
+    TI_REAL short_ema = ptr->state.short_ema;
+    TI_REAL long_ema = ptr->state.long_ema;
+    TI_REAL signal_ema = ptr->state.signal_ema;
+
+    int i = 0;
+    for (; i < size && progress == -(long_period-1); ++i, ++progress) {
+        short_ema = input[i];
+        long_ema = input[i];
+    }
+    for (; i < size && progress < 0; ++i, ++progress) {
+        short_ema = (input[i]-short_ema) * short_per + short_ema;
+        long_ema = (input[i]-long_ema) * long_per + long_ema;
+    }
+    for (; i < size && progress == 0; ++i, ++progress) {
+        short_ema = (input[i]-short_ema) * short_per + short_ema;
+        long_ema = (input[i]-long_ema) * long_per + long_ema;
+        const TI_REAL out = short_ema - long_ema;
+
+        signal_ema = out;
+        signal_ema = (out-signal_ema) * signal_per + signal_ema;
+
+        *macd++ = out;
+        *signal++ = signal_ema;
+        *hist++ = out - signal_ema;
+    }
+    for (; i < size; ++i, ++progress) {
+        short_ema = (input[i]-short_ema) * short_per + short_ema;
+        long_ema = (input[i]-long_ema) * long_per + long_ema;
+        const TI_REAL out = short_ema - long_ema;
+
+        signal_ema = (out-signal_ema) * signal_per + signal_ema;
+
+        *macd++ = out;
+        *signal++ = signal_ema;
+        *hist++ = out - signal_ema;
+    }
+
+    ptr->progress = progress;
+    ptr->state.short_ema = short_ema;
+    ptr->state.long_ema = long_ema;
+    ptr->state.signal_ema = signal_ema;
+
+    return TI_OKAY;
+}
+
+int ti_macd_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_macd_stream const *ptr = static_cast<ti_macd_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL input = inputs[0][0];
+    const TI_REAL short_ema = (input-ptr->state.short_ema) * ptr->constants.short_per + ptr->state.short_ema;
+    const TI_REAL long_ema = (input-ptr->state.long_ema) * ptr->constants.long_per + ptr->state.long_ema;
+    const TI_REAL out = short_ema - long_ema;
+
+    /* the signal ema is seeded with the first macd value */
+    const TI_REAL signal_ema = ptr->progress == 0 ? out : (out-ptr->state.signal_ema) * ptr->constants.signal_per + ptr->state.signal_ema;
+
+    outputs[0][0] = out;
+    outputs[1][0] = signal_ema;
+    outputs[2][0] = out - signal_ema;
+
+    return TI_OKAY;
+}
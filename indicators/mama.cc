@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/minmax.h"
 
 int ti_mama_start(TI_REAL const *options) {
@@ -192,7 +193,7 @@ int ti_mama_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_mama_stream : ti_stream {
+struct ti_mama_stream : stream_base {
     struct {
         TI_REAL fastlimit;
         TI_REAL slowlimit;
@@ -233,6 +234,7 @@ int ti_mama_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_MAMA_INDEX;
     ptr->progress = -ti_mama_start(options);
+    ptr->keep_options(options);
 
     ptr->options.fastlimit = fastlimit;
     ptr->options.slowlimit = slowlimit;
@@ -244,6 +246,8 @@ void ti_mama_stream_free(ti_stream *stream) {
     delete static_cast<ti_mama_stream*>(stream);
 }
 
+STREAM_IO(mama, s.state)
+
 int ti_mama_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_mama_stream *ptr = static_cast<ti_mama_stream*>(stream);
     int progress = ptr->progress;
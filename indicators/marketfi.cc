@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_marketfi_start(TI_REAL const *options) {
@@ -33,3 +36,47 @@ int ti_marketfi(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     assert(output - outputs[0] == size - ti_marketfi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_marketfi_stream : stream_base {
+    struct {
+        /* none, every bar stands alone */
+    } state;
+};
+
+
+int ti_marketfi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_marketfi_stream *ptr = new(std::nothrow) ti_marketfi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MARKETFI_INDEX;
+    ptr->progress = -ti_marketfi_start(options);
+    ptr->keep_options(options);
+
+    return TI_OKAY;
+}
+
+void ti_marketfi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_marketfi_stream*>(stream);
+}
+
+STREAM_IO(marketfi, s.state)
+
+int ti_marketfi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_marketfi_stream *ptr = static_cast<ti_marketfi_stream*>(stream);
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *volume = inputs[2];
+    TI_REAL *output = outputs[0];
+
+    int i;
+    for (i = 0; i < size; ++i) {
+        *output++ = volume[i] ? (high[i] - low[i]) / volume[i] : 0;
+    }
+
+    ptr->progress += size;
+
+    return TI_OKAY;
+}
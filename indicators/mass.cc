@@ -5,8 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_mass_start(TI_REAL const *options) {
@@ -64,3 +68,123 @@ int ti_mass(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(output - outputs[0] == size - ti_mass_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_mass_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL ema;
+        TI_REAL ema2;
+        TI_REAL sum;
+        ringbuf<0> ratio;
+    } state;
+
+    struct {
+        TI_REAL per;
+        TI_REAL per1;
+    } constants;
+};
+
+
+int ti_mass_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_mass_stream *ptr = new(std::nothrow) ti_mass_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MASS_INDEX;
+    ptr->progress = -ti_mass_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    /*mass uses a hard-coded 9 period for the ema*/
+    ptr->constants.per = 2 / (9.0 + 1);
+    ptr->constants.per1 = 1.0 - ptr->constants.per;
+
+    try {
+        ptr->state.ratio.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_mass_stream_free(ti_stream *stream) {
+    delete static_cast<ti_mass_stream*>(stream);
+}
+
+STREAM_IO(mass, s.state.ema, s.state.ema2, s.state.sum, s.state.ratio)
+
+int ti_mass_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_mass_stream *ptr = static_cast<ti_mass_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL per1 = ptr->constants.per1;
+
+    TI_REAL ema = ptr->state.ema;
+    TI_REAL ema2 = ptr->state.ema2;
+    TI_REAL sum = ptr->state.sum;
+    auto &ratio = ptr->state.ratio;
+
+    /* the bar index of the batch loop is progress + 16 + period-1; the ratios
+       are summed from the bar 16 on, the ring dropping its zeros until full */
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        const int bar = progress + 16 + period-1;
+        TI_REAL hl = high[i] - low[i];
+
+        if (bar == 0) {
+            ema = hl;
+        }
+        ema = ema * per1 + hl * per;
+
+        if (bar == 8) {
+            ema2 = ema;
+        }
+        if (bar >= 8) {
+            ema2 = ema2 * per1 + ema * per;
+
+            if (bar >= 16) {
+                const TI_REAL r = ema ? ema/ema2 : 0;
+                sum -= ratio;
+                sum += r;
+                ratio = r;
+                step(ratio);
+            }
+        }
+    }
+    for (; i < size; ++i, ++progress, step(ratio)) {
+        TI_REAL hl = high[i] - low[i];
+
+        ema = ema * per1 + hl * per;
+        ema2 = ema2 * per1 + ema * per;
+
+        const TI_REAL r = ema ? ema/ema2 : 0;
+        sum -= ratio;
+        sum += r;
+        ratio = r;
+
+        *output++ = sum;
+    }
+
+    ptr->progress = progress;
+    ptr->state.ema = ema;
+    ptr->state.ema2 = ema2;
+    ptr->state.sum = sum;
+
+    return TI_OKAY;
+}
@@ -7,6 +7,9 @@
 
 #include <new>
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 
 
 int ti_md_start(TI_REAL const *options) {
@@ -14,7 +17,66 @@ int ti_md_start(TI_REAL const *options) {
 }
 
 
-int ti_md(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* The windows shorter than this are cheaper to sum over directly, the
+ * per-bar cost of the tree is about that of a direct pass over 1000 values */
+static const int tree_period = 1000;
+
+
+int ti_md(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+    const int period = (int)options[0];
+    TI_REAL *output = outputs[0];
+
+    const TI_REAL scale = 1.0 / period;
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (size <= ti_md_start(options)) return TI_OKAY;
+
+    if (period < tree_period) {
+        TI_REAL sum = 0;
+
+        int i;
+        for (i = 0; i < size; ++i) {
+            const TI_REAL today = input[i];
+            sum += today;
+            if (i >= period) sum -= input[i-period];
+
+            const TI_REAL avg = sum * scale;
+
+            if (i >= period - 1) {
+                *output++ = sum_deviation(input + i - (period-1), period, avg) * scale;
+            }
+        }
+    } else {
+        orderstat window(period);
+        ringbuf<0> price(period);
+
+        int progress = -ti_md_start(options);
+
+        int i = 0;
+        for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+            price = input[i];
+            window.insert(input[i]);
+        }
+        for (; i < size; ++i, ++progress, step(price)) {
+            price = input[i];
+            window.insert(input[i]);
+
+            const TI_REAL avg = window.sum() * scale;
+            *output++ = window.sum_deviation(avg) * scale;
+
+            window.erase(price[period-1]);
+        }
+    }
+
+    assert(output - outputs[0] == size - ti_md_start(options));
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+int ti_md_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *input = inputs[0];
     const int period = (int)options[0];
     TI_REAL *output = outputs[0];
@@ -49,3 +111,105 @@ int ti_md(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     return TI_OKAY;
 
 }
+
+
+struct ti_md_stream : stream_base {
+
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL sum; /* of the last period-1 values, below tree_period */
+        orderstat window; /* from tree_period up */
+        ringbuf<0> price;
+    } state;
+};
+
+int ti_md_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+
+    if (period < 1) { return TI_INVALID_OPTION; }
+
+    ti_md_stream *ptr = new(std::nothrow) ti_md_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MD_INDEX;
+    ptr->progress = -ti_md_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        if (period >= tree_period) { ptr->state.window.reserve(period); }
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_md_stream_free(ti_stream *stream) {
+    delete static_cast<ti_md_stream*>(stream);
+}
+
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_md_stream &s) {
+    if (s.options.period >= tree_period) {
+        orderstat_refill(s.state.window, s.state.price, s.progress + s.options.period-1);
+    }
+}
+
+STREAM_IO(md, s.state.sum, s.state.price)
+
+int ti_md_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_md_stream *ptr = static_cast<ti_md_stream*>(stream);
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+    int progress = ptr->progress;
+    const int period = ptr->options.period;
+    const TI_REAL scale = 1.0 / period;
+    auto &window = ptr->state.window;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    if (period < tree_period) {
+        /* the ring holds exactly the window, in whatever order */
+        TI_REAL sum = ptr->state.sum;
+        for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+            price = input[i];
+            sum += input[i];
+        }
+        for (; i < size; ++i, ++progress, step(price)) {
+            price = input[i];
+            sum += input[i];
+
+            const TI_REAL avg = sum * scale;
+            *output++ = sum_deviation(price.phbegin(), period, avg) * scale;
+
+            sum -= price[period-1];
+        }
+        ptr->state.sum = sum;
+    } else {
+        for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+            price = input[i];
+            window.insert(input[i]);
+        }
+        for (; i < size; ++i, ++progress, step(price)) {
+            price = input[i];
+            window.insert(input[i]);
+
+            const TI_REAL avg = window.sum() * scale;
+            *output++ = window.sum_deviation(avg) * scale;
+
+            window.erase(price[period-1]);
+        }
+    }
+
+    ptr->progress = progress;
+
+    return TI_OKAY;
+}
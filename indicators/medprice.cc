@@ -6,6 +6,7 @@
 
 
 #include "../indicators.h"
+#include "../utils/dispatch.h"
 
 
 int ti_medprice_start(TI_REAL const *options) {
@@ -14,6 +15,7 @@ int ti_medprice_start(TI_REAL const *options) {
 }
 
 
+TI_DISPATCH
 int ti_medprice(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *high = inputs[0];
     const TI_REAL *low = inputs[1];
@@ -23,6 +25,7 @@ int ti_medprice(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     TI_REAL *output = outputs[0];
 
     int i;
+    TI_SIMD
     for (i = 0; i < size; ++i) {
         output[i] = (high[i] + low[i]) * 0.5;
     }
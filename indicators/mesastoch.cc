@@ -12,6 +12,7 @@
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_mesastoch_start(TI_REAL const *options) {
     int period = options[0];
@@ -169,7 +170,7 @@ int ti_mesastoch_ref(int size, TI_REAL const *const *inputs, TI_REAL const *opti
     return TI_OKAY;
 }
 
-struct ti_mesastoch_stream : ti_stream {
+struct ti_mesastoch_stream : stream_base {
     struct {
         int period;
         int max_cycle_considered;
@@ -183,7 +184,7 @@ struct ti_mesastoch_stream : ti_stream {
     } state;
 
     struct {
-        ringbuf<0> filt;
+        ringbuf_minmax<0> filt;
         ringbuf<3> HP;
         ringbuf<2> stoc;
         ringbuf<3> result;
@@ -213,6 +214,7 @@ int ti_mesastoch_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_MESASTOCH_INDEX;
     ptr->progress = -ti_mesastoch_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.max_cycle_considered = max_cycle_considered;
@@ -238,6 +240,8 @@ void ti_mesastoch_stream_free(ti_stream *stream) {
     delete static_cast<ti_mesastoch_stream*>(stream);
 }
 
+STREAM_IO(mesastoch, s.state, s.store.filt, s.store.HP, s.store.stoc, s.store.result, s.store.price)
+
 int ti_mesastoch_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_mesastoch_stream *ptr = static_cast<ti_mesastoch_stream*>(stream);
     TI_REAL const *const series = inputs[0];
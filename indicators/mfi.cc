@@ -5,8 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 #define TYPPRICE(INDEX) ((high[(INDEX)] + low[(INDEX)] + close[(INDEX)]) * (1.0/3.0))
 
@@ -62,3 +66,103 @@ int ti_mfi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_mfi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_mfi_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL ytyp;
+        TI_REAL up_sum;
+        TI_REAL down_sum;
+        ringbuf<0> up;
+        ringbuf<0> down;
+    } state;
+};
+
+
+int ti_mfi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_mfi_stream *ptr = new(std::nothrow) ti_mfi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MFI_INDEX;
+    ptr->progress = -ti_mfi_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.up.resize(period);
+        ptr->state.down.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_mfi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_mfi_stream*>(stream);
+}
+
+STREAM_IO(mfi, s.state.ytyp, s.state.up_sum, s.state.down_sum, s.state.up, s.state.down)
+
+int ti_mfi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_mfi_stream *ptr = static_cast<ti_mfi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    const TI_REAL *volume = inputs[3];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+
+    TI_REAL ytyp = ptr->state.ytyp;
+    TI_REAL up_sum = ptr->state.up_sum;
+    TI_REAL down_sum = ptr->state.down_sum;
+    auto &up = ptr->state.up;
+    auto &down = ptr->state.down;
+
+    /* the rings start zeroed, dropping their zeros while they fill up is exact */
+    int i = 0;
+    for (; i < size && progress == -period; ++i, ++progress) {
+        ytyp = TYPPRICE(i);
+    }
+    for (; i < size; ++i, ++progress, step(up), step(down)) {
+        const TI_REAL typ = TYPPRICE(i);
+        const TI_REAL bar = typ * volume[i];
+
+        const TI_REAL up_bar = typ > ytyp ? bar : 0.0;
+        const TI_REAL down_bar = typ < ytyp ? bar : 0.0;
+
+        up_sum -= up;
+        up_sum += up_bar;
+        up = up_bar;
+
+        down_sum -= down;
+        down_sum += down_bar;
+        down = down_bar;
+
+        ytyp = typ;
+
+        if (progress >= 0) {
+            *output++ = up_sum ? up_sum / (up_sum + down_sum) * 100.0 : 0;
+        }
+    }
+
+    ptr->progress = progress;
+    ptr->state.ytyp = ytyp;
+    ptr->state.up_sum = up_sum;
+    ptr->state.down_sum = down_sum;
+
+    return TI_OKAY;
+}
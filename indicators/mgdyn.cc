@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_mgdyn_start(TI_REAL const *options) {
     return 0;
@@ -57,7 +58,7 @@ DONTOPTIMIZE int ti_mgdyn_ref(int size, TI_REAL const *const *inputs, TI_REAL co
     return TI_OKAY;
 }
 
-struct ti_mgdyn_stream : ti_stream {
+struct ti_mgdyn_stream : stream_base {
 
     struct {
         TI_REAL N;
@@ -81,6 +82,7 @@ int ti_mgdyn_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_MGDYN_INDEX;
     ptr->progress = -ti_mgdyn_start(options);
+    ptr->keep_options(options);
 
     ptr->options.N = N;
 
@@ -93,6 +95,8 @@ void ti_mgdyn_stream_free(ti_stream *stream) {
     delete static_cast<ti_mgdyn_stream*>(stream);
 }
 
+STREAM_IO(mgdyn, s.state)
+
 int ti_mgdyn_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_mgdyn_stream *ptr = static_cast<ti_mgdyn_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_mhlma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -152,7 +153,7 @@ DONTOPTIMIZE int ti_mhlma_ref(int size, TI_REAL const *const *inputs, TI_REAL co
     return TI_OKAY;
 }
 
-struct ti_mhlma_stream : ti_stream {
+struct ti_mhlma_stream : stream_base {
 
     struct {
         int period;
@@ -169,7 +170,7 @@ struct ti_mhlma_stream : ti_stream {
         int ll_idx = 0;
 
         ringbuf<0> mhl;
-        ringbuf<0> price;
+        ringbuf_minmax<0> price;
     } state;
 
     struct {
@@ -189,6 +190,7 @@ int ti_mhlma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_MHLMA_INDEX;
     ptr->progress = -ti_mhlma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.ma_period = ma_period;
@@ -203,6 +205,10 @@ void ti_mhlma_stream_free(ti_stream *stream) {
     delete static_cast<ti_mhlma_stream*>(stream);
 }
 
+STREAM_IO(mhlma,
+    s.state.sum, s.state.ema, s.state.hh, s.state.ll, s.state.hh_idx, s.state.ll_idx, s.state.mhl,
+    s.state.price)
+
 int ti_mhlma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_mhlma_stream *ptr = static_cast<ti_mhlma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -256,7 +262,7 @@ int ti_mhlma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
         price = series[i];
 
         if (hh_idx == progress - period) {
-            auto it = std::max_element(price.phbegin(), price.phend());
+            auto it = price.find_max(period);
             hh = *it;
             hh_idx = progress - price.iterator_to_age(it);
         } else if (series[i] >= hh) {
@@ -264,7 +270,7 @@ int ti_mhlma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
             hh_idx = progress;
         }
         if (ll_idx == progress - period) {
-            auto it = std::min_element(price.phbegin(), price.phend());
+            auto it = price.find_min(period);
             ll = *it;
             ll_idx = progress - price.iterator_to_age(it);
         } else if (series[i] <= ll) {
@@ -281,7 +287,7 @@ int ti_mhlma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
         price = series[i];
 
         if (hh_idx == progress - period) {
-            auto it = std::max_element(price.phbegin(), price.phend());
+            auto it = price.find_max(period);
             hh = *it;
             hh_idx = progress - price.iterator_to_age(it);
         } else if (series[i] >= hh) {
@@ -289,7 +295,7 @@ int ti_mhlma_stream_run(ti_stream *stream, int size, TI_REAL const *const *input
             hh_idx = progress;
         }
         if (ll_idx == progress - period) {
-            auto it = std::min_element(price.phbegin(), price.phend());
+            auto it = price.find_min(period);
             ll = *it;
             ll_idx = progress - price.iterator_to_age(it);
         } else if (series[i] <= ll) {
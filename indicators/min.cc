@@ -5,7 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/range.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_min_start(TI_REAL const *options) {
@@ -50,6 +55,11 @@ int ti_min(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     return TI_OKAY;
 }
 
+
+int ti_min_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_min, 1, size, inputs, options, ti_min_start(options), first_output, count, outputs);
+}
+
 int ti_min_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *input = inputs[0];
     const int period = (int)options[0];
@@ -71,3 +81,70 @@ int ti_min_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     assert(output - outputs[0] == size - ti_min_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_min_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        ringbuf_minmax<0> price;
+    } state;
+};
+
+
+int ti_min_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_min_stream *ptr = new(std::nothrow) ti_min_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MIN_INDEX;
+    ptr->progress = -ti_min_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_min_stream_free(ti_stream *stream) {
+    delete static_cast<ti_min_stream*>(stream);
+}
+
+STREAM_IO(min, s.state.price)
+
+int ti_min_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_min_stream *ptr = static_cast<ti_min_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = input[i];
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        price = input[i];
+        *output++ = *price.find_min(period);
+    }
+
+    ptr->progress = progress;
+
+    return TI_OKAY;
+}
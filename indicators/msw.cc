@@ -6,7 +6,10 @@
 
 
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include <new>
+#include <vector>
 
 
 int ti_msw_start(TI_REAL const *options) {
@@ -14,7 +17,32 @@ int ti_msw_start(TI_REAL const *options) {
 }
 
 
-int ti_msw(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* The dft of the window X_i = sum_j x_{i-j} w^j, w = e^(i*tpi/period), slides as
+ * X_i = x_i + w X_{i-1} - w^period x_{i-period}, w^period being slightly off 1 with this pi.
+ * Every period bars it is recomputed over the window to drop the rounding accumulated by the recursion.
+ */
+
+static const TI_REAL pi = 3.1415926;
+static const TI_REAL tpi = 2 * pi;
+
+static void msw_phase(TI_REAL rp, TI_REAL ip, TI_REAL *sine, TI_REAL *lead) {
+    TI_REAL phase;
+    if (fabs(rp) > .001) {
+        phase = atan(ip/rp);
+    } else {
+        phase = tpi / 2.0 * (ip < 0 ? -1.0 : 1.0);
+    }
+    if (rp < 0.0) phase += pi;
+    phase += pi/2.0;
+    if (phase < 0.0) phase += tpi;
+    if (phase > tpi) phase -= tpi;
+
+    *sine = sin(phase);
+    *lead = sin(phase + pi/4.0);
+}
+
+
+int ti_msw(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
     const TI_REAL *input = inputs[0];
     TI_REAL *sine = outputs[0];
     TI_REAL *lead = outputs[1];
@@ -23,8 +51,58 @@ int ti_msw(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     if (period < 1) return TI_INVALID_OPTION;
     if (size <= ti_msw_start(options)) return TI_OKAY;
 
-    const TI_REAL pi = 3.1415926;
-    const TI_REAL tpi = 2 * pi;
+    std::vector<TI_REAL> cosines(period), sines(period);
+    for (int j = 0; j < period; ++j) {
+        cosines[j] = cos(tpi * j / period);
+        sines[j] = sin(tpi * j / period);
+    }
+    const TI_REAL wr = cos(tpi / period), wi = sin(tpi / period);
+    const TI_REAL wpr = cos(tpi), wpi = sin(tpi);
+
+    ringbuf<0> price(period);
+    TI_REAL rp = 0, ip = 0;
+    int refresh = period;
+
+    int progress = -ti_msw_start(options);
+
+    for (int i = 0; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
+        price = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            rp = 0;
+            ip = 0;
+            for (int j = 0; j < period; ++j) {
+                rp = rp + cosines[j] * price[j];
+                ip = ip + sines[j] * price[j];
+            }
+        } else {
+            const TI_REAL rp_ = input[i] + wr * rp - wi * ip - wpr * oldest;
+            const TI_REAL ip_ = wr * ip + wi * rp - wpi * oldest;
+            rp = rp_;
+            ip = ip_;
+        }
+
+        if (progress >= 0) { msw_phase(rp, ip, sine++, lead++); }
+    }
+
+    assert(sine - outputs[0] == size - ti_msw_start(options));
+    assert(lead - outputs[1] == size - ti_msw_start(options));
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+int ti_msw_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+    const TI_REAL *input = inputs[0];
+    TI_REAL *sine = outputs[0];
+    TI_REAL *lead = outputs[1];
+    const int period = (int)options[0];
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (size <= ti_msw_start(options)) return TI_OKAY;
 
     TI_REAL weight = 0, phase;
     TI_REAL rp, ip;
@@ -58,3 +136,117 @@ int ti_msw(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(lead - outputs[1] == size - ti_msw_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_msw_stream : stream_base {
+
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL rp;
+        TI_REAL ip;
+        int refresh;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        TI_REAL wr, wi;
+        TI_REAL wpr, wpi;
+        std::vector<TI_REAL> cosines;
+        std::vector<TI_REAL> sines;
+    } constants;
+};
+
+int ti_msw_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+
+    if (period < 1) { return TI_INVALID_OPTION; }
+
+    ti_msw_stream *ptr = new(std::nothrow) ti_msw_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_MSW_INDEX;
+    ptr->progress = -ti_msw_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->state.rp = 0;
+    ptr->state.ip = 0;
+    ptr->state.refresh = period;
+
+    ptr->constants.wr = cos(tpi / period);
+    ptr->constants.wi = sin(tpi / period);
+    ptr->constants.wpr = cos(tpi);
+    ptr->constants.wpi = sin(tpi);
+
+    try {
+        ptr->state.price.resize(period);
+        ptr->constants.cosines.resize(period);
+        ptr->constants.sines.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+    for (int j = 0; j < period; ++j) {
+        ptr->constants.cosines[j] = cos(tpi * j / period);
+        ptr->constants.sines[j] = sin(tpi * j / period);
+    }
+
+    return TI_OKAY;
+}
+
+void ti_msw_stream_free(ti_stream *stream) {
+    delete static_cast<ti_msw_stream*>(stream);
+}
+
+STREAM_IO(msw, s.state.rp, s.state.ip, s.state.refresh, s.state.price)
+
+int ti_msw_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_msw_stream *ptr = static_cast<ti_msw_stream*>(stream);
+    const TI_REAL *input = inputs[0];
+    TI_REAL *sine = outputs[0];
+    TI_REAL *lead = outputs[1];
+    int progress = ptr->progress;
+    const int period = ptr->options.period;
+    TI_REAL rp = ptr->state.rp;
+    TI_REAL ip = ptr->state.ip;
+    int refresh = ptr->state.refresh;
+    auto &price = ptr->state.price;
+    const TI_REAL wr = ptr->constants.wr, wi = ptr->constants.wi;
+    const TI_REAL wpr = ptr->constants.wpr, wpi = ptr->constants.wpi;
+    const TI_REAL *cosines = ptr->constants.cosines.data();
+    const TI_REAL *sines = ptr->constants.sines.data();
+
+    for (int i = 0; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
+        price = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            rp = 0;
+            ip = 0;
+            for (int j = 0; j < period; ++j) {
+                rp = rp + cosines[j] * price[j];
+                ip = ip + sines[j] * price[j];
+            }
+        } else {
+            const TI_REAL rp_ = input[i] + wr * rp - wi * ip - wpr * oldest;
+            const TI_REAL ip_ = wr * ip + wi * rp - wpi * oldest;
+            rp = rp_;
+            ip = ip_;
+        }
+
+        if (progress >= 0) { msw_phase(rp, ip, sine++, lead++); }
+    }
+
+    ptr->progress = progress;
+    ptr->state.rp = rp;
+    ptr->state.ip = ip;
+    ptr->state.refresh = refresh;
+
+    return TI_OKAY;
+}
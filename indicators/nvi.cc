@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_nvi_start(TI_REAL const *options) {
@@ -39,3 +42,68 @@ int ti_nvi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_nvi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_nvi_stream : stream_base {
+    struct {
+        TI_REAL nvi;
+        TI_REAL last_close;
+        TI_REAL last_volume;
+    } state;
+};
+
+
+int ti_nvi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_nvi_stream *ptr = new(std::nothrow) ti_nvi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_NVI_INDEX;
+    ptr->progress = -ti_nvi_start(options);
+    ptr->keep_options(options);
+
+    ptr->state.nvi = 1000;
+
+    return TI_OKAY;
+}
+
+void ti_nvi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_nvi_stream*>(stream);
+}
+
+STREAM_IO(nvi, s.state)
+
+int ti_nvi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_nvi_stream *ptr = static_cast<ti_nvi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *close = inputs[0];
+    const TI_REAL *volume = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL nvi = ptr->state.nvi;
+    TI_REAL last_close = ptr->state.last_close;
+    TI_REAL last_volume = ptr->state.last_volume;
+
+    int i = 0;
+    for (; i < size && progress == 0; ++i, ++progress) {
+        *output++ = nvi;
+        last_close = close[i];
+        last_volume = volume[i];
+    }
+    for (; i < size; ++i, ++progress) {
+        if (volume[i] < last_volume) {
+            nvi += ((close[i] - last_close)/last_close) * nvi;
+        }
+        *output++ = nvi;
+        last_close = close[i];
+        last_volume = volume[i];
+    }
+
+    ptr->progress = progress;
+    ptr->state.nvi = nvi;
+    ptr->state.last_close = last_close;
+    ptr->state.last_volume = last_volume;
+
+    return TI_OKAY;
+}
@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_obv_start(TI_REAL const *options) {
@@ -45,3 +48,66 @@ int ti_obv(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
 
     return TI_OKAY;
 }
+
+
+struct ti_obv_stream : stream_base {
+    struct {
+        TI_REAL sum;
+        TI_REAL prev;
+    } state;
+};
+
+
+int ti_obv_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_obv_stream *ptr = new(std::nothrow) ti_obv_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_OBV_INDEX;
+    ptr->progress = -ti_obv_start(options);
+    ptr->keep_options(options);
+
+    return TI_OKAY;
+}
+
+void ti_obv_stream_free(ti_stream *stream) {
+    delete static_cast<ti_obv_stream*>(stream);
+}
+
+STREAM_IO(obv, s.state)
+
+int ti_obv_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_obv_stream *ptr = static_cast<ti_obv_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *close = inputs[0];
+    const TI_REAL *volume = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL sum = ptr->state.sum;
+    TI_REAL prev = ptr->state.prev;
+
+    int i = 0;
+    for (; i < size && progress == 0; ++i, ++progress) {
+        prev = close[i];
+        *output++ = sum;
+    }
+    for (; i < size; ++i, ++progress) {
+        if (close[i] > prev) {
+            sum += volume[i];
+        } else if (close[i] < prev) {
+            sum -= volume[i];
+        } else {
+            /* No change. */
+        }
+
+        prev = close[i];
+        *output++ = sum;
+    }
+
+    ptr->progress = progress;
+    ptr->state.sum = sum;
+    ptr->state.prev = prev;
+
+    return TI_OKAY;
+}
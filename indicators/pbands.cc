@@ -8,12 +8,19 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/hull.hh"
+#include "../utils/stream.hh"
 
 int ti_pbands_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
     return period-1;
 }
 
+/* high[i-j] + j*b = (high[t] - b*t) + i*b with t = i-j, so the bands are the max/min of y - b*x
+ * over the points (t, high[t]) and (t, low[t]) of the window, kept on a sliding hull.
+ * The windows shorter than this are cheaper to scan directly */
+static const int hull_period = 64;
+
 int ti_pbands(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
     TI_REAL const *high = inputs[0];
     TI_REAL const *low = inputs[1];
@@ -23,6 +30,7 @@ int ti_pbands(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     TI_REAL *pbands_upper = outputs[1];
 
     if (period < 1) { return TI_INVALID_OPTION; }
+    if (size <= ti_pbands_start(options)) { return TI_OKAY; }
 
     TI_REAL y_sum = 0.;
     TI_REAL xy_sum = 0.;
@@ -30,15 +38,49 @@ int ti_pbands(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     const TI_REAL x_sum = period * (period + 1) / 2.;
     const TI_REAL xsq_sum = period * (period + 1) * (2*period + 1) / 6.;
 
-    TI_REAL max;
-    TI_REAL min;
-    int max_idx;
-    int min_idx;
+    if (period < hull_period) {
+        int i = 0;
+        for (; i < period-1 && i < size; ++i) {
+            xy_sum += close[i] * (i + 1);
+            y_sum += close[i];
+        }
+        for (; i < size; ++i) {
+            xy_sum += close[i] * period;
+            y_sum += close[i];
+
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+
+            TI_REAL the_max = high[i];
+            for (int j = 1; j < period; ++j) {
+                if (the_max < high[i-j] + j * b) {
+                    the_max = high[i-j] + j * b;
+                }
+            }
+            TI_REAL the_min = low[i];
+            for (int j = 1; j < period; ++j) {
+                if (the_min > low[i-j] + j * b) {
+                    the_min = low[i-j] + j * b;
+                }
+            }
+            *pbands_upper++ = the_max;
+            *pbands_lower++ = the_min;
+
+            xy_sum -= y_sum;
+            y_sum -= close[i-period+1];
+        }
+
+        return TI_OKAY;
+    }
+
+    sliding_hull hull;
+    hull.reserve(period);
 
     int i = 0;
     for (; i < period-1 && i < size; ++i) {
         xy_sum += close[i] * (i + 1);
         y_sum += close[i];
+        hull.push(i, high[i], low[i]);
     }
     for (; i < size; ++i) {
         xy_sum += close[i] * period;
@@ -47,20 +89,9 @@ int ti_pbands(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
         // y = a + bx
         TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
 
-        TI_REAL the_max = high[i];
-        for (int j = 1; j < period; ++j) {
-            if (the_max < high[i-j] + j * b) {
-                the_max = high[i-j] + j * b;
-            }
-        }
-        TI_REAL the_min = low[i];
-        for (int j = 1; j < period; ++j) {
-            if (the_min > low[i-j] + j * b) {
-                the_min = low[i-j] + j * b;
-            }
-        }
-        *pbands_upper++ = the_max;
-        *pbands_lower++ = the_min;
+        hull.push(i, high[i], low[i]);
+        hull.bands(i, b, pbands_upper++, pbands_lower++);
+        hull.pop();
 
         xy_sum -= y_sum;
         y_sum -= close[i-period+1];
@@ -108,7 +139,7 @@ int ti_pbands_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options
 }
 
 
-struct ti_pbands_stream : ti_stream {
+struct ti_pbands_stream : stream_base {
     struct {
         TI_REAL period;
     } options;
@@ -117,9 +148,10 @@ struct ti_pbands_stream : ti_stream {
         TI_REAL y_sum;
         TI_REAL xy_sum;
 
-        ringbuf<0> price_high;
-        ringbuf<0> price_low;
+        ringbuf<0> price_high; /* below hull_period */
+        ringbuf<0> price_low; /* below hull_period */
         ringbuf<0> price_close;
+        sliding_hull hull; /* from hull_period up */
     } state;
 
     struct {
@@ -138,6 +170,7 @@ int ti_pbands_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_PBANDS_INDEX;
     ptr->progress = -ti_pbands_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -148,8 +181,12 @@ int ti_pbands_stream_new(TI_REAL const *options, ti_stream **stream) {
     ptr->constants.xsq_sum = period * (period + 1) * (2*period + 1) / 6.;
 
     try {
-        ptr->state.price_high.resize(period+1);
-        ptr->state.price_low.resize(period+1);
+        if (period < hull_period) {
+            ptr->state.price_high.resize(period+1);
+            ptr->state.price_low.resize(period+1);
+        } else {
+            ptr->state.hull.reserve(period);
+        }
         ptr->state.price_close.resize(period+1);
     } catch (std::bad_alloc& e) {
         delete ptr;
@@ -163,6 +200,10 @@ void ti_pbands_stream_free(ti_stream *stream) {
     delete static_cast<ti_pbands_stream*>(stream);
 }
 
+STREAM_IO(pbands,
+    s.state.y_sum, s.state.xy_sum, s.state.price_high, s.state.price_low, s.state.price_close,
+    s.state.hull)
+
 int ti_pbands_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_pbands_stream *ptr = static_cast<ti_pbands_stream*>(stream);
 
@@ -185,45 +226,73 @@ int ti_pbands_stream_run(ti_stream *stream, int size, TI_REAL const *const *inpu
     auto &price_high = ptr->state.price_high;
     auto &price_low = ptr->state.price_low;
     auto &price_close = ptr->state.price_close;
+    auto &hull = ptr->state.hull;
 
     int i = 0;
-    for (; progress < 0 && i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
-        price_high = high[i];
-        price_low = low[i];
-        price_close = close[i];
-
-        xy_sum += close[i] * (progress - (-period+1) + 1);
-        y_sum += close[i];
-    }
+    if (period < hull_period) {
+        for (; progress < 0 && i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
+            price_high = high[i];
+            price_low = low[i];
+            price_close = close[i];
+
+            xy_sum += close[i] * (progress - (-period+1) + 1);
+            y_sum += close[i];
+        }
 
-    for (; i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
-        price_high = high[i];
-        price_low = low[i];
-        price_close = close[i];
+        for (; i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
+            price_high = high[i];
+            price_low = low[i];
+            price_close = close[i];
 
-        xy_sum += close[i] * period;
-        y_sum += close[i];
+            xy_sum += close[i] * period;
+            y_sum += close[i];
 
-        // y = a + bx
-        TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
 
-        TI_REAL the_max = high[i];
-        for (int j = 1; j < period; ++j) {
-            if (the_max < price_high[j] + j * b) {
-                the_max = price_high[j] + j * b;
+            TI_REAL the_max = high[i];
+            for (int j = 1; j < period; ++j) {
+                if (the_max < price_high[j] + j * b) {
+                    the_max = price_high[j] + j * b;
+                }
             }
-        }
-        TI_REAL the_min = low[i];
-        for (int j = 1; j < period; ++j) {
-            if (the_min > price_low[j] + j * b) {
-                the_min = price_low[j] + j * b;
+            TI_REAL the_min = low[i];
+            for (int j = 1; j < period; ++j) {
+                if (the_min > price_low[j] + j * b) {
+                    the_min = price_low[j] + j * b;
+                }
             }
+            *pbands_upper++ = the_max;
+            *pbands_lower++ = the_min;
+
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
         }
-        *pbands_upper++ = the_max;
-        *pbands_lower++ = the_min;
+    } else {
+        for (; progress < 0 && i < size; ++i, ++progress, step(price_close)) {
+            price_close = close[i];
+            hull.push(progress, high[i], low[i]);
 
-        xy_sum -= y_sum;
-        y_sum -= price_close[period-1];
+            xy_sum += close[i] * (progress - (-period+1) + 1);
+            y_sum += close[i];
+        }
+
+        for (; i < size; ++i, ++progress, step(price_close)) {
+            price_close = close[i];
+            hull.push(progress, high[i], low[i]);
+
+            xy_sum += close[i] * period;
+            y_sum += close[i];
+
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+
+            hull.bands(progress, b, pbands_upper++, pbands_lower++);
+
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
+            hull.pop();
+        }
     }
 
     ptr->progress = progress;
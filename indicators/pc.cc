@@ -10,6 +10,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_pc_start(TI_REAL const *options) {
@@ -84,7 +85,7 @@ int ti_pc_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     return TI_OKAY;
 }
 
-struct ti_pc_stream : ti_stream {
+struct ti_pc_stream : stream_base {
     struct {
         int period;
     } options;
@@ -95,8 +96,8 @@ struct ti_pc_stream : ti_stream {
         int max_idx = 0;
         int min_idx = 0;
 
-        ringbuf<0> price_low;
-        ringbuf<0> price_high;
+        ringbuf_minmax<0> price_low;
+        ringbuf_minmax<0> price_high;
     } state;
 
     struct {
@@ -115,6 +116,7 @@ int ti_pc_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_PC_INDEX;
     ptr->progress = -ti_pc_start(options);
+    ptr->keep_options(options);
     ptr->options.period = period;
 
     try {
@@ -132,6 +134,10 @@ void ti_pc_stream_free(ti_stream *stream) {
     delete static_cast<ti_pc_stream*>(stream);
 }
 
+STREAM_IO(pc,
+    s.state.max, s.state.min, s.state.max_idx, s.state.min_idx, s.state.price_low,
+    s.state.price_high)
+
 int ti_pc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_pc_stream *ptr = static_cast<ti_pc_stream*>(stream);
     int progress = ptr->progress;
@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 #include "../utils/log.h"
 
 int ti_pfe_start(TI_REAL const *options) {
@@ -100,7 +101,7 @@ int ti_pfe_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     return TI_OKAY;
 }
 
-struct ti_pfe_stream : ti_stream {
+struct ti_pfe_stream : stream_base {
     struct {
         int period;
         int ema_period;
@@ -133,6 +134,7 @@ int ti_pfe_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_PFE_INDEX;
     ptr->progress = -ti_pfe_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = options[0];
     ptr->options.ema_period = options[1];
@@ -154,6 +156,8 @@ void ti_pfe_stream_free(ti_stream *stream) {
     delete static_cast<ti_pfe_stream*>(stream);
 }
 
+STREAM_IO(pfe, s.state.ema, s.state.numer, s.state.sum, s.state.price, s.state.denom)
+
 int ti_pfe_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_pfe_stream *ptr = static_cast<ti_pfe_stream*>(stream);
 
@@ -5,10 +5,12 @@
 
 
 #include <new>
-#include <algorithm>
+#include <vector>
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/hull.hh"
+#include "../utils/stream.hh"
 
 int ti_posc_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -17,9 +19,10 @@ int ti_posc_start(TI_REAL const *options) {
 }
 
 
+/* as in ti_pbands, the windows shorter than this are cheaper to scan directly */
+static const int hull_period = 64;
+
 int ti_posc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
-    TI_REAL const *high = inputs[0];
-    TI_REAL const *low = inputs[1];
     TI_REAL const *close = inputs[2];
     const int period = options[0];
     const int ema_period = options[1];
@@ -29,61 +32,21 @@ int ti_posc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     if (ema_period < 1) { return TI_INVALID_OPTION; }
     if (size <= ti_posc_start(options)) { return TI_OKAY; }
 
-    TI_REAL y_sum = 0.;
-    TI_REAL xy_sum = 0.;
-    TI_REAL ema;
-
-    const TI_REAL x_sum = period * (period + 1) / 2.;
-    const TI_REAL xsq_sum = period * (period + 1) * (2*period + 1) / 6.;
-
-    int i = 0;
-    for (; i < period-1 && i < size; ++i) {
-        xy_sum += close[i] * (i + 1);
-        y_sum += close[i];
-    }
-    for (; i < period && i < size; ++i) {
-        xy_sum += close[i] * period;
-        y_sum += close[i];
-        // y = a + bx
-        TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
-
-        TI_REAL the_max = high[i];
-        for (int j = 1; j < period; ++j) {
-            the_max = std::max(the_max, high[i-j] + j * b);
-        }
-        TI_REAL the_min = low[i];
-        for (int j = 1; j < period; ++j) {
-            the_min = std::min(the_min, low[i-j] + j * b);
-        }
+    /* the bands themselves switch between the direct loops and the hull by the period */
+    const int start = ti_posc_start(options);
+    std::vector<TI_REAL> lower(size - start), upper(size - start);
+    TI_REAL *bands[] = {lower.data(), upper.data()};
+    const int ret = ti_pbands(size, inputs, options, bands);
+    if (ret != TI_OKAY) { return ret; }
 
-        ema = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
-        *posc++ = ema;
-
-        xy_sum -= y_sum;
-        y_sum -= close[i-period+1];
-    }
-    for (; i < size; ++i) {
-        xy_sum += close[i] * period;
-        y_sum += close[i];
-
-        // y = a + bx
-        TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
-
-        TI_REAL the_max = high[i];
-        for (int j = 1; j < period; ++j) {
-            the_max = std::max(the_max, high[i-j] + j * b);
-        }
-        TI_REAL the_min = low[i];
-        for (int j = 1; j < period; ++j) {
-            the_min = std::min(the_min, low[i-j] + j * b);
-        }
+    TI_REAL ema = 0;
+    for (int i = start; i < size; ++i) {
+        const TI_REAL the_min = lower[i-start];
+        const TI_REAL the_max = upper[i-start];
 
         TI_REAL osc = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
-        ema = (osc - ema) * 2. / (1 + ema_period) + ema;
+        ema = i == start ? osc : (osc - ema) * 2. / (1 + ema_period) + ema;
         *posc++ = ema;
-
-        xy_sum -= y_sum;
-        y_sum -= close[i-(int)period+1];
     }
     return TI_OKAY;
 } catch (std::bad_alloc& e) {
@@ -127,7 +90,7 @@ int ti_posc_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
 }
 
 
-struct ti_posc_stream : ti_stream {
+struct ti_posc_stream : stream_base {
     struct {
         TI_REAL period;
         TI_REAL ema_period;
@@ -138,9 +101,10 @@ struct ti_posc_stream : ti_stream {
         TI_REAL xy_sum;
         TI_REAL ema;
 
-        ringbuf<0> price_high;
-        ringbuf<0> price_low;
+        ringbuf<0> price_high; /* below hull_period */
+        ringbuf<0> price_low; /* below hull_period */
         ringbuf<0> price_close;
+        sliding_hull hull; /* from hull_period up */
     } state;
 
     struct {
@@ -161,6 +125,7 @@ int ti_posc_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_POSC_INDEX;
     ptr->progress = -ti_posc_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.ema_period = ema_period;
@@ -172,8 +137,12 @@ int ti_posc_stream_new(TI_REAL const *options, ti_stream **stream) {
     ptr->constants.xsq_sum = period * (period + 1) * (2*period + 1) / 6.;
 
     try {
-        ptr->state.price_high.resize(period+1);
-        ptr->state.price_low.resize(period+1);
+        if (period < hull_period) {
+            ptr->state.price_high.resize(period+1);
+            ptr->state.price_low.resize(period+1);
+        } else {
+            ptr->state.hull.reserve(period);
+        }
         ptr->state.price_close.resize(period+1);
     } catch (std::bad_alloc& e) {
         delete ptr;
@@ -187,6 +156,10 @@ void ti_posc_stream_free(ti_stream *stream) {
     delete static_cast<ti_posc_stream*>(stream);
 }
 
+STREAM_IO(posc,
+    s.state.y_sum, s.state.xy_sum, s.state.ema, s.state.price_high, s.state.price_low, s.state.price_close,
+    s.state.hull)
+
 int ti_posc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_posc_stream *ptr = static_cast<ti_posc_stream*>(stream);
 
@@ -210,66 +183,116 @@ int ti_posc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs
     auto &price_high = ptr->state.price_high;
     auto &price_low = ptr->state.price_low;
     auto &price_close = ptr->state.price_close;
+    auto &hull = ptr->state.hull;
 
     int i = 0;
-    for (; i < size && progress < 0; ++i, ++progress, step(price_high, price_low, price_close)) {
-        price_high = high[i];
-        price_low = low[i];
-        price_close = close[i];
+    if (period < hull_period) {
+        for (; i < size && progress < 0; ++i, ++progress, step(price_high, price_low, price_close)) {
+            price_high = high[i];
+            price_low = low[i];
+            price_close = close[i];
+
+            xy_sum += close[i] * (progress - (-period+1) + 1);
+            y_sum += close[i];
+        }
+        for (; i < size && progress < 1; ++i, ++progress, step(price_high, price_low, price_close)) {
+            price_high = high[i];
+            price_low = low[i];
+            price_close = close[i];
 
-        xy_sum += close[i] * (progress - (-period+1) + 1);
-        y_sum += close[i];
-    }
-    for (; i < size && progress < 1; ++i, ++progress, step(price_high, price_low, price_close)) {
-        price_high = high[i];
-        price_low = low[i];
-        price_close = close[i];
+            xy_sum += close[i] * period;
+            y_sum += close[i];
 
-        xy_sum += close[i] * period;
-        y_sum += close[i];
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
 
-        // y = a + bx
-        TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+            TI_REAL the_max = price_high;
+            for (int j = 1; j < period; ++j) {
+                the_max = std::max(the_max, price_high[j] + j * b);
+            }
+            TI_REAL the_min = price_low;
+            for (int j = 1; j < period; ++j) {
+                the_min = std::min(the_min, price_low[j] + j * b);
+            }
+            ema = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
+            *posc++ = ema;
 
-        TI_REAL the_max = price_high;
-        for (int j = 1; j < period; ++j) {
-            the_max = std::max(the_max, price_high[j] + j * b);
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
         }
-        TI_REAL the_min = price_low;
-        for (int j = 1; j < period; ++j) {
-            the_min = std::min(the_min, price_low[j] + j * b);
-        }
-        ema = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
-        *posc++ = ema;
+        for (; i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
+            price_high = high[i];
+            price_low = low[i];
+            price_close = close[i];
 
-        xy_sum -= y_sum;
-        y_sum -= price_close[period-1];
-    }
-    for (; i < size; ++i, ++progress, step(price_high, price_low, price_close)) {
-        price_high = high[i];
-        price_low = low[i];
-        price_close = close[i];
+            xy_sum += close[i] * period;
+            y_sum += close[i];
 
-        xy_sum += close[i] * period;
-        y_sum += close[i];
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
 
-        // y = a + bx
-        TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+            TI_REAL the_max = price_high;
+            for (int j = 1; j < period; ++j) {
+                the_max = std::max(the_max, price_high[j] + j * b);
+            }
+            TI_REAL the_min = price_low;
+            for (int j = 1; j < period; ++j) {
+                the_min = std::min(the_min, price_low[j] + j * b);
+            }
+            TI_REAL osc = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
+            ema = (osc - ema) * 2. / (1 + ema_period) + ema;
+            *posc++ = ema;
 
-        TI_REAL the_max = price_high;
-        for (int j = 1; j < period; ++j) {
-            the_max = std::max(the_max, price_high[j] + j * b);
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
         }
-        TI_REAL the_min = price_low;
-        for (int j = 1; j < period; ++j) {
-            the_min = std::min(the_min, price_low[j] + j * b);
+    } else {
+        for (; i < size && progress < 0; ++i, ++progress, step(price_close)) {
+            price_close = close[i];
+            hull.push(progress, high[i], low[i]);
+
+            xy_sum += close[i] * (progress - (-period+1) + 1);
+            y_sum += close[i];
         }
-        TI_REAL osc = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
-        ema = (osc - ema) * 2. / (1 + ema_period) + ema;
-        *posc++ = ema;
+        for (; i < size && progress < 1; ++i, ++progress, step(price_close)) {
+            price_close = close[i];
+            hull.push(progress, high[i], low[i]);
+
+            xy_sum += close[i] * period;
+            y_sum += close[i];
+
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+
+            TI_REAL the_max, the_min;
+            hull.bands(progress, b, &the_max, &the_min);
+            ema = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
+            *posc++ = ema;
 
-        xy_sum -= y_sum;
-        y_sum -= price_close[period-1];
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
+            hull.pop();
+        }
+        for (; i < size; ++i, ++progress, step(price_close)) {
+            price_close = close[i];
+            hull.push(progress, high[i], low[i]);
+
+            xy_sum += close[i] * period;
+            y_sum += close[i];
+
+            // y = a + bx
+            TI_REAL b = (xy_sum / period - x_sum / period * y_sum / period) / (xsq_sum / period - (x_sum / period)*(x_sum / period));
+
+            TI_REAL the_max, the_min;
+            hull.bands(progress, b, &the_max, &the_min);
+            TI_REAL osc = (close[i] - the_min) ? (close[i] - the_min) / (the_max - the_min) * 100. : 0;
+            ema = (osc - ema) * 2. / (1 + ema_period) + ema;
+            *posc++ = ema;
+
+            xy_sum -= y_sum;
+            y_sum -= price_close[period-1];
+            hull.pop();
+        }
     }
 
     ptr->progress = progress;
@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_ppo_start(TI_REAL const *options) {
@@ -46,3 +49,98 @@ int ti_ppo(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(ppo - outputs[0] == size - ti_ppo_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_ppo_stream : stream_base {
+    struct {
+        int short_period;
+        int long_period;
+    } options;
+
+    struct {
+        TI_REAL short_ema;
+        TI_REAL long_ema;
+    } state;
+
+    struct {
+        TI_REAL short_per;
+        TI_REAL long_per;
+    } constants;
+};
+
+
+int ti_ppo_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int long_period = (int)options[1];
+
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (long_period < 2) return TI_INVALID_OPTION;
+    if (long_period < short_period) return TI_INVALID_OPTION;
+
+    ti_ppo_stream *ptr = new(std::nothrow) ti_ppo_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_PPO_INDEX;
+    ptr->progress = -ti_ppo_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.long_period = long_period;
+
+    ptr->constants.short_per = 2 / ((TI_REAL)short_period + 1);
+    ptr->constants.long_per = 2 / ((TI_REAL)long_period + 1);
+
+    return TI_OKAY;
+}
+
+void ti_ppo_stream_free(ti_stream *stream) {
+    delete static_cast<ti_ppo_stream*>(stream);
+}
+
+STREAM_IO(ppo, s.state)
+
+int ti_ppo_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ppo_stream *ptr = static_cast<ti_ppo_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *ppo = outputs[0];
+
+    const TI_REAL short_per = ptr->constants.short_per;
+    const TI_REAL long_per = ptr->constants.long_per;
+
+    TI_REAL short_ema = ptr->state.short_ema;
+    TI_REAL long_ema = ptr->state.long_ema;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        short_ema = input[i];
+        long_ema = input[i];
+    }
+    for (; i < size; ++i, ++progress) {
+        short_ema = (input[i]-short_ema) * short_per + short_ema;
+        long_ema = (input[i]-long_ema) * long_per + long_ema;
+        const TI_REAL out = short_ema - long_ema ? 100.0 * (short_ema - long_ema) / long_ema : 0;
+
+        *ppo++ = out;
+    }
+
+    ptr->progress = progress;
+    ptr->state.short_ema = short_ema;
+    ptr->state.long_ema = long_ema;
+
+    return TI_OKAY;
+}
+
+int ti_ppo_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ppo_stream const *ptr = static_cast<ti_ppo_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL input = inputs[0][0];
+    const TI_REAL short_ema = (input-ptr->state.short_ema) * ptr->constants.short_per + ptr->state.short_ema;
+    const TI_REAL long_ema = (input-ptr->state.long_ema) * ptr->constants.long_per + ptr->state.long_ema;
+    outputs[0][0] = short_ema - long_ema ? 100.0 * (short_ema - long_ema) / long_ema : 0;
+
+    return TI_OKAY;
+}
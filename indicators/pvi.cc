@@ -5,8 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 
 int ti_pvi_start(TI_REAL const *options) {
@@ -40,3 +43,68 @@ int ti_pvi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_pvi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_pvi_stream : stream_base {
+    struct {
+        TI_REAL pvi;
+        TI_REAL last_close;
+        TI_REAL last_volume;
+    } state;
+};
+
+
+int ti_pvi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    ti_pvi_stream *ptr = new(std::nothrow) ti_pvi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_PVI_INDEX;
+    ptr->progress = -ti_pvi_start(options);
+    ptr->keep_options(options);
+
+    ptr->state.pvi = 1000;
+
+    return TI_OKAY;
+}
+
+void ti_pvi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_pvi_stream*>(stream);
+}
+
+STREAM_IO(pvi, s.state)
+
+int ti_pvi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_pvi_stream *ptr = static_cast<ti_pvi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *close = inputs[0];
+    const TI_REAL *volume = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL pvi = ptr->state.pvi;
+    TI_REAL last_close = ptr->state.last_close;
+    TI_REAL last_volume = ptr->state.last_volume;
+
+    int i = 0;
+    for (; i < size && progress == 0; ++i, ++progress) {
+        *output++ = pvi;
+        last_close = close[i];
+        last_volume = volume[i];
+    }
+    for (; i < size; ++i, ++progress) {
+        if (volume[i] > last_volume && last_volume > 0) {
+            pvi += ((close[i] - last_close)/last_close) * pvi;
+        }
+        *output++ = pvi;
+        last_close = close[i];
+        last_volume = volume[i];
+    }
+
+    ptr->progress = progress;
+    ptr->state.pvi = pvi;
+    ptr->state.last_close = last_close;
+    ptr->state.last_volume = last_volume;
+
+    return TI_OKAY;
+}
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_pvt_start(TI_REAL const *options) {
     return 1;
@@ -49,7 +50,7 @@ DONTOPTIMIZE int ti_pvt_ref(int size, TI_REAL const *const *inputs, TI_REAL cons
     return TI_OKAY;
 }
 
-struct ti_pvt_stream : ti_stream {
+struct ti_pvt_stream : stream_base {
 
     struct {
         TI_REAL last_close;
@@ -66,6 +67,7 @@ int ti_pvt_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_PVT_INDEX;
     ptr->progress = -ti_pvt_start(options);
+    ptr->keep_options(options);
 
     return TI_OKAY;
 }
@@ -74,6 +76,8 @@ void ti_pvt_stream_free(ti_stream *stream) {
     delete static_cast<ti_pvt_stream*>(stream);
 }
 
+STREAM_IO(pvt, s.state)
+
 int ti_pvt_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_pvt_stream *ptr = static_cast<ti_pvt_stream*>(stream);
     TI_REAL const *const close = inputs[0];
@@ -4,12 +4,16 @@
  */
 
 
+#include <vector>
 #include <new>
+#include <type_traits>
 
 #include "../indicators.h"
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/fir.hh"
+#include "../utils/stream.hh"
 
 int ti_pwma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -18,7 +22,71 @@ int ti_pwma_start(TI_REAL const *options) {
     return period-1;
 }
 
-int ti_pwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* For an integer power k, the numerator is the last of the sums S_m = sum_j (period-j)^m x_{i-j}, m = 0..k.
+ * A bar later the weight period-j of every value becomes period-j-1, so by the binomial expansion
+ * S_m <- sum_{r<=m} C(m,r) (-1)^(m-r) S_r + period^m x_i, less x_{i-period} in S_0 (its weight is now 0).
+ * Every period bars the sums are recomputed over the window to drop the rounding of the updates.
+ */
+
+static const int pwma_max_power = 6;
+
+/* C(m,r) (-1)^(m-r) */
+static const TI_REAL pwma_binomial[pwma_max_power+1][pwma_max_power+1] = {
+    {1},
+    {-1, 1},
+    {1, -2, 1},
+    {-1, 3, -3, 1},
+    {1, -4, 6, -4, 1},
+    {-1, 5, -10, 10, -5, 1},
+    {1, -6, 15, -20, 15, -6, 1},
+};
+
+/* whether to slide the sums: each update costs about as much as (power+1)^2 / 8 taps of the fir */
+static bool pwma_sliding(int period, TI_REAL power) {
+    return power >= 0 && power <= pwma_max_power && power == (int)power && period >= 8 * (power+1) * (power+1);
+}
+
+/* calls f(std::integral_constant<int, power>), so that the sums below are unrolled and kept in registers */
+template<class F>
+static void pwma_with_power(int power, F f) {
+    switch (power) {
+        case 0: f(std::integral_constant<int, 0>()); break;
+        case 1: f(std::integral_constant<int, 1>()); break;
+        case 2: f(std::integral_constant<int, 2>()); break;
+        case 3: f(std::integral_constant<int, 3>()); break;
+        case 4: f(std::integral_constant<int, 4>()); break;
+        case 5: f(std::integral_constant<int, 5>()); break;
+        case 6: f(std::integral_constant<int, 6>()); break;
+    }
+}
+
+/* period_m[m] = period^m; every S_m is added last, so that the bars depend on each other by one addition */
+template<int K>
+static void pwma_slide(TI_REAL *sums, TI_REAL const *period_m, TI_REAL newest, TI_REAL oldest) {
+    for (int m = K; m >= 0; --m) {
+        TI_REAL sum = m ? period_m[m] * newest : newest - oldest;
+        for (int r = 0; r < m; ++r) {
+            sum += pwma_binomial[m][r] * sums[r];
+        }
+        sums[m] = sum + sums[m];
+    }
+}
+
+/* at(j) is the value j bars ago */
+template<int K, class At>
+static void pwma_refresh(TI_REAL *sums, int period, At at) {
+    for (int m = 0; m <= K; ++m) { sums[m] = 0; }
+    for (int j = 0; j < period; ++j) {
+        const TI_REAL x = at(j);
+        TI_REAL weight = 1;
+        for (int m = 0; m <= K; ++m) {
+            sums[m] += weight * x;
+            weight *= period - j;
+        }
+    }
+}
+
+int ti_pwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
     TI_REAL const *const series = inputs[0];
     const int period = options[0];
     const TI_REAL power = options[1];
@@ -32,15 +100,40 @@ int ti_pwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
         denom += pow(i+1, power);
     }
 
-    for (int i = period-1; i < size; ++i) {
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            numer += series[i-j] * pow(period-j, power);
-        }
-        *pwma++ = numer / denom;
+    if (size < period) { return TI_OKAY; }
+
+    if (pwma_sliding(period, power)) {
+        const TI_REAL denom_recipr = 1. / denom;
+        pwma_with_power(power, [&](auto k) {
+            constexpr int K = decltype(k)::value;
+            TI_REAL period_m[K+1], sums[K+1];
+            period_m[0] = 1;
+            for (int m = 1; m <= K; ++m) { period_m[m] = period_m[m-1] * period; }
+
+            int refresh = 0;
+            for (int i = period-1; i < size; ++i) {
+                if (refresh-- == 0) {
+                    refresh = period-1;
+                    pwma_refresh<K>(sums, period, [&](int j) { return series[i-j]; });
+                } else {
+                    pwma_slide<K>(sums, period_m, series[i], series[i-period]);
+                }
+                *pwma++ = sums[K] * denom_recipr;
+            }
+        });
+        return TI_OKAY;
     }
 
+    std::vector<TI_REAL> weights(period);
+    for (int j = 0; j < period; ++j) {
+        weights[j] = pow(period-j, power);
+    }
+
+    fir_run(weights.data(), period, 1. / denom, series, size, pwma);
+
     return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
 }
 
 DONTOPTIMIZE int ti_pwma_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
@@ -68,7 +161,7 @@ DONTOPTIMIZE int ti_pwma_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_pwma_stream : ti_stream {
+struct ti_pwma_stream : stream_base {
 
     struct {
         int period;
@@ -77,10 +170,13 @@ struct ti_pwma_stream : ti_stream {
 
     struct {
         ringbuf<0> price;
+        TI_REAL sums[pwma_max_power+1];
+        int refresh;
     } state;
 
     struct {
         TI_REAL denom_recipr = 0;
+        std::vector<TI_REAL> weights;
     } constants;
 };
 
@@ -96,16 +192,25 @@ int ti_pwma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_PWMA_INDEX;
     ptr->progress = -ti_pwma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.power = power;
 
     try {
         ptr->state.price.resize(period+1);
+        ptr->constants.weights.resize(period);
     } catch (std::bad_alloc& e) {
+        delete ptr;
         return TI_OUT_OF_MEMORY;
     }
 
+    for (int j = 0; j < period; ++j) {
+        ptr->constants.weights[j] = pow(period-j, power);
+    }
+
+    ptr->state.refresh = 0;
+
     for (int i = 0; i < period; ++i) {
         ptr->constants.denom_recipr += pow(i+1, power);
     }
@@ -118,6 +223,8 @@ void ti_pwma_stream_free(ti_stream *stream) {
     delete static_cast<ti_pwma_stream*>(stream);
 }
 
+STREAM_IO(pwma, s.state.price, s.state.sums, s.state.refresh)
+
 int ti_pwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_pwma_stream *ptr = static_cast<ti_pwma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -127,20 +234,40 @@ int ti_pwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs
     const TI_REAL power = ptr->options.power;
     const TI_REAL denom_recipr = ptr->constants.denom_recipr;
     auto &price = ptr->state.price;
+    const std::vector<TI_REAL> &weights = ptr->constants.weights;
 
     int i = 0;
 
     for (; progress < 0 && i < size; ++i, ++progress, step(price)) {
         price = series[i];
     }
+    if (pwma_sliding(period, power)) {
+        pwma_with_power(power, [&](auto k) {
+            constexpr int K = decltype(k)::value;
+            TI_REAL period_m[K+1], sums[K+1];
+            period_m[0] = 1;
+            for (int m = 1; m <= K; ++m) { period_m[m] = period_m[m-1] * period; }
+            for (int m = 0; m <= K; ++m) { sums[m] = ptr->state.sums[m]; }
+
+            int refresh = ptr->state.refresh;
+            for (; i < size; ++i, ++progress, step(price)) {
+                price = series[i];
+                if (refresh-- == 0) {
+                    refresh = period-1;
+                    pwma_refresh<K>(sums, period, [&](int j) { return price[j]; });
+                } else {
+                    pwma_slide<K>(sums, period_m, series[i], price[period]);
+                }
+                *pwma++ = sums[K] * denom_recipr;
+            }
+
+            for (int m = 0; m <= K; ++m) { ptr->state.sums[m] = sums[m]; }
+            ptr->state.refresh = refresh;
+        });
+    }
     for (; i < size; ++i, ++progress, step(price)) {
         price = series[i];
-
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            numer += price[j] * pow(period-j, power);
-        }
-        *pwma++ = numer * denom_recipr;
+        *pwma++ = fir_dot(weights.data(), period, price) * denom_recipr;
     }
 
     ptr->progress = progress;
@@ -10,6 +10,7 @@
 #include "../indicators.h"
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_rema_start(TI_REAL const *options) {
     TI_REAL period = options[0];
@@ -51,7 +52,7 @@ int ti_rema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     return TI_OKAY;
 }
 
-struct ti_rema_stream : ti_stream {
+struct ti_rema_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -81,6 +82,7 @@ int ti_rema_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_REMA_INDEX;
     ptr->progress = -ti_rema_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.lambda = lambda;
@@ -94,6 +96,8 @@ void ti_rema_stream_free(ti_stream *stream) {
     delete static_cast<ti_rema_stream*>(stream);
 }
 
+STREAM_IO(rema, s.state)
+
 int ti_rema_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_rema_stream *ptr = static_cast<ti_rema_stream*>(stream);
     TI_REAL const *const series = inputs[0];
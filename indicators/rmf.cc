@@ -6,12 +6,13 @@
 
 #include <new>
 #include <utility>
-#include <deque>
-#include <set>
 
 #include "../indicators.h"
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/orderstat.hh"
+#include "../utils/stream.hh"
 
 const TI_REAL PI = acos(-1);
 
@@ -22,7 +23,37 @@ int ti_rmf_start(TI_REAL const *options) {
     return median_period-1;
 }
 
-int ti_rmf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+/* Below this the median is taken from a sorted array rather than the treap, see sorted_window */
+static const int tree_period = 4096;
+
+/* runs the filter over size bars, rankedprice holding the values of price[1..] that have been inserted */
+template<class Window>
+static void rmf_run(int size, TI_REAL const *series, int period, TI_REAL alpha, int &progress, TI_REAL &rmf_val,
+        Window &rankedprice, ringbuf<0> &price, TI_REAL *rmf) {
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = series[i];
+        rankedprice.insert(series[i]);
+    }
+    for (; i < size && progress == 0; ++i, ++progress, step(price)) {
+        price = series[i];
+        rankedprice.insert(series[i]);
+        rmf_val = rankedprice.select(period / 2);
+        *rmf++ = rmf_val;
+
+        rankedprice.erase(price[period-1]);
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        price = series[i];
+        rankedprice.insert(series[i]);
+        rmf_val = alpha * rankedprice.select(period / 2) + (1. - alpha) * rmf_val;
+        *rmf++ = rmf_val;
+
+        rankedprice.erase(price[period-1]);
+    }
+}
+
+int ti_rmf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) try {
     TI_REAL const *const series = inputs[0];
     TI_REAL critical_period = options[0];
     TI_REAL median_period = options[1];
@@ -32,41 +63,28 @@ int ti_rmf(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     if (critical_period < 1) { return TI_INVALID_OPTION; }
     if ((int)median_period % 2 != 1) { return TI_INVALID_OPTION; }
 
+    const int period = median_period;
+
     TI_REAL rmf_val;
-    std::multiset<TI_REAL> rankedprice;
-    std::deque<TI_REAL> price;
+    ringbuf<0> price(period);
 
     TI_REAL alpha = (cos(2*PI/critical_period) + sin(2*PI/critical_period) - 1.) / cos(2*PI/critical_period);
     int progress = -ti_rmf_start(options);
 
-    int i = 0;
-    for (; i < size && progress < 0; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-    }
-    for (; i < size && progress == 0; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-        rmf_val = *std::next(rankedprice.begin(), median_period / 2);
-        *rmf++ = rmf_val;
-
-        rankedprice.erase(rankedprice.find(price.front()));
-        price.pop_front();
-    }
-    for (; i < size; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-        rmf_val = alpha * *std::next(rankedprice.begin(), median_period / 2) + (1. - alpha) * rmf_val;
-        *rmf++ = rmf_val;
-
-        rankedprice.erase(rankedprice.find(price.front()));
-        price.pop_front();
+    if (period < tree_period) {
+        sorted_window rankedprice(period);
+        rmf_run(size, series, period, alpha, progress, rmf_val, rankedprice, price, rmf);
+    } else {
+        orderstat rankedprice(period);
+        rmf_run(size, series, period, alpha, progress, rmf_val, rankedprice, price, rmf);
     }
 
     return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
 }
 
-struct ti_rmf_stream : ti_stream {
+struct ti_rmf_stream : stream_base {
 
     struct {
         TI_REAL median_period;
@@ -75,8 +93,9 @@ struct ti_rmf_stream : ti_stream {
 
     struct {
         TI_REAL rmf_val;
-        std::multiset<TI_REAL> rankedprice;
-        std::deque<TI_REAL> price;
+        sorted_window short_rankedprice; /* below tree_period */
+        orderstat rankedprice; /* from tree_period up */
+        ringbuf<0> price;
     } state;
 
     struct {
@@ -98,12 +117,25 @@ int ti_rmf_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_RMF_INDEX;
     ptr->progress = -ti_rmf_start(options);
+    ptr->keep_options(options);
 
     ptr->options.median_period = median_period;
     ptr->options.critical_period = critical_period;
 
     ptr->constants.alpha = (cos(2*PI/critical_period) + sin(2*PI/critical_period) - 1.) / cos(2*PI/critical_period);
 
+    try {
+        if (median_period < tree_period) {
+            ptr->state.short_rankedprice.reserve(median_period);
+        } else {
+            ptr->state.rankedprice.reserve(median_period);
+        }
+        ptr->state.price.resize(median_period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
     return TI_OKAY;
 }
 
@@ -111,40 +143,31 @@ void ti_rmf_stream_free(ti_stream *stream) {
     delete static_cast<ti_rmf_stream*>(stream);
 }
 
+/* the orderstat is not saved, it is put back from the ring */
+static void stream_restore(ti_rmf_stream &s) {
+    const int n = s.progress + (int)s.options.median_period-1;
+    if (s.options.median_period < tree_period) {
+        orderstat_refill(s.state.short_rankedprice, s.state.price, n);
+    } else {
+        orderstat_refill(s.state.rankedprice, s.state.price, n);
+    }
+}
+
+STREAM_IO(rmf, s.state.rmf_val, s.state.price)
+
 int ti_rmf_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_rmf_stream *ptr = static_cast<ti_rmf_stream*>(stream);
     TI_REAL const *const series = inputs[0];
     TI_REAL *rmf = outputs[0];
     int progress = ptr->progress;
-    TI_REAL median_period = ptr->options.median_period;
-    TI_REAL critical_period = ptr->options.critical_period;
+    const int period = ptr->options.median_period;
     TI_REAL alpha = ptr->constants.alpha;
     TI_REAL rmf_val = ptr->state.rmf_val;
-    auto &price = ptr->state.price;
-    auto &rankedprice = ptr->state.rankedprice;
-
-    int i = 0;
-    for (; i < size && progress < 0; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-    }
-    for (; i < size && progress == 0; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-        rmf_val = *std::next(rankedprice.begin(), median_period / 2);
-        *rmf++ = rmf_val;
-
-        rankedprice.erase(rankedprice.find(price.front()));
-        price.pop_front();
-    }
-    for (; i < size; ++i, ++progress) {
-        price.push_back(series[i]);
-        rankedprice.insert(price.back());
-        rmf_val = alpha * *std::next(rankedprice.begin(), median_period / 2) + (1. - alpha) * rmf_val;
-        *rmf++ = rmf_val;
 
-        rankedprice.erase(rankedprice.find(price.front()));
-        price.pop_front();
+    if (period < tree_period) {
+        rmf_run(size, series, period, alpha, progress, rmf_val, ptr->state.short_rankedprice, ptr->state.price, rmf);
+    } else {
+        rmf_run(size, series, period, alpha, progress, rmf_val, ptr->state.rankedprice, ptr->state.price, rmf);
     }
 
     ptr->progress = progress;
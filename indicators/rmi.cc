@@ -9,6 +9,7 @@
 #include "../indicators.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_rmi_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -83,7 +84,7 @@ int ti_rmi_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     return TI_OKAY;
 }
 
-struct ti_rmi_stream : ti_stream {
+struct ti_rmi_stream : stream_base {
     struct {
         TI_REAL period;
         TI_REAL lookback_period;
@@ -113,6 +114,7 @@ int ti_rmi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_RMI_INDEX;
     ptr->progress = -ti_rmi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.lookback_period = lookback_period;
@@ -131,6 +133,8 @@ void ti_rmi_stream_free(ti_stream *stream) {
     delete static_cast<ti_rmi_stream*>(stream);
 }
 
+STREAM_IO(rmi, s.state.gains_ema, s.state.losses_ema, s.state.price)
+
 int ti_rmi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_rmi_stream *ptr = static_cast<ti_rmi_stream*>(stream);
 
@@ -9,6 +9,7 @@
 
 #include "../indicators.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_roof_start(TI_REAL const *options) {
     return 0;
@@ -48,7 +49,7 @@ int ti_roof(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     return TI_OKAY;
 }
 
-struct ti_roof_stream : ti_stream {
+struct ti_roof_stream : stream_base {
 
     struct {
         
@@ -80,6 +81,7 @@ int ti_roof_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_ROOF_INDEX;
     ptr->progress = -ti_roof_start(options);
+    ptr->keep_options(options);
 
     return TI_OKAY;
 }
@@ -88,6 +90,8 @@ void ti_roof_stream_free(ti_stream *stream) {
     delete static_cast<ti_roof_stream*>(stream);
 }
 
+STREAM_IO(roof, s.state)
+
 int ti_roof_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_roof_stream *ptr = static_cast<ti_roof_stream*>(stream);
     TI_REAL const *series = inputs[0];
@@ -5,7 +5,14 @@
  */
 
 
+#include <new>
+#include <vector>
+
 #include "../indicators.h"
+#include "../utils/minmax.h"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
+#include "../utils/stream.hh"
 
 
 int ti_rsi_start(TI_REAL const *options) {
@@ -49,3 +56,228 @@ int ti_rsi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_rsi_start(options));
     return TI_OKAY;
 }
+
+
+int ti_rsi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    const TI_REAL *input = inputs[0];
+    const int period = (int)options[0];
+    TI_REAL *output = outputs[0];
+    const TI_REAL per = 1.0 / ((TI_REAL)period);
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (!range_check(size, ti_rsi_start(options), first_output, count)) return TI_INVALID_OPTION;
+    if (count == 0) return TI_OKAY;
+
+    TI_REAL smooth_up = 0, smooth_down = 0;
+
+    int i;
+    for (i = 1; i <= period; ++i) {
+        const TI_REAL upward = input[i] > input[i-1] ? input[i] - input[i-1] : 0;
+        const TI_REAL downward = input[i] < input[i-1] ? input[i-1] - input[i] : 0;
+        smooth_up += upward;
+        smooth_down += downward;
+    }
+
+    smooth_up /= period;
+    smooth_down /= period;
+
+    #define UPDATE() do { \
+        const TI_REAL upward = input[i] > input[i-1] ? input[i] - input[i-1] : 0; \
+        const TI_REAL downward = input[i] < input[i-1] ? input[i-1] - input[i] : 0; \
+        smooth_up = (upward-smooth_up) * per + smooth_up; \
+        smooth_down = (downward-smooth_down) * per + smooth_down; \
+    } while (0)
+
+    const int first = period + first_output;
+    for (; i <= first; ++i) {
+        UPDATE();
+    }
+    *output++ = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+
+    for (; i < first + count; ++i) {
+        UPDATE();
+        *output++ = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+    }
+
+    #undef UPDATE
+
+    assert(output - outputs[0] == count);
+    return TI_OKAY;
+}
+
+int ti_rsi_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    /* The gains and losses are shared by all periods, their prefix sums give the initial averages. */
+    std::vector<TI_REAL> upward(size);
+    std::vector<TI_REAL> downward(size);
+    for (int i = 1; i < size; ++i) {
+        upward[i] = input[i] > input[i-1] ? input[i] - input[i-1] : 0;
+        downward[i] = input[i] < input[i-1] ? input[i-1] - input[i] : 0;
+    }
+    std::vector<TI_REAL> upward_sum(size+1);
+    std::vector<TI_REAL> downward_sum(size+1);
+    prefix_sum(size, upward.data(), 0, upward_sum.data(), [](int, TI_REAL x) { return x; });
+    prefix_sum(size, downward.data(), 0, downward_sum.data(), [](int, TI_REAL x) { return x; });
+
+    std::vector<TI_REAL> smooth_up(nparams);
+    std::vector<TI_REAL> smooth_down(nparams);
+
+    for (int tile = 0; tile < size; tile += multi_tile) {
+        const int tile_end = MIN(size, tile + multi_tile);
+
+        for (int p = 0; p < nparams; ++p) {
+            const int period = (int)multi_options(options, 1, p)[0];
+            const TI_REAL per = 1.0 / ((TI_REAL)period);
+            TI_REAL *output = multi_output(outputs, 0, size, p);
+
+            int i = MAX(tile, period);
+            if (i >= tile_end) { continue; }
+
+            TI_REAL up = smooth_up[p];
+            TI_REAL down = smooth_down[p];
+            if (i == period) {
+                up = upward_sum[period+1] * per;
+                down = downward_sum[period+1] * per;
+                output[i-period] = up ? 100.0 * (up / (up + down)) : 0;
+                ++i;
+            }
+            for (; i < tile_end; ++i) {
+                up = (upward[i]-up) * per + up;
+                down = (downward[i]-down) * per + down;
+                output[i-period] = up ? 100.0 * (up / (up + down)) : 0;
+            }
+            smooth_up[p] = up;
+            smooth_down[p] = down;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+struct ti_rsi_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL last;
+        TI_REAL smooth_up;
+        TI_REAL smooth_down;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_rsi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_rsi_stream *ptr = new(std::nothrow) ti_rsi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_RSI_INDEX;
+    ptr->progress = -ti_rsi_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 1.0 / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_rsi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_rsi_stream*>(stream);
+}
+
+STREAM_IO(rsi, s.state)
+
+int ti_rsi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_rsi_stream *ptr = static_cast<ti_rsi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL last = ptr->state.last;
+    TI_REAL smooth_up = ptr->state.smooth_up;
+    TI_REAL smooth_down = ptr->state.smooth_down;
+
+    #define UPDATE_SUMS() do { \
+        smooth_up += input[i] > last ? input[i] - last : 0; \
+        smooth_down += input[i] < last ? last - input[i] : 0; \
+        last = input[i]; \
+    } while (0)
+
+    /* while warming up, smooth_up and smooth_down hold the sums of the moves */
+    int i = 0;
+    for (; i < size && progress == -period; ++i, ++progress) {
+        last = input[i];
+    }
+    for (; i < size && progress < 0; ++i, ++progress) {
+        UPDATE_SUMS();
+    }
+    for (; i < size && progress == 0; ++i, ++progress) {
+        UPDATE_SUMS();
+        smooth_up /= period;
+        smooth_down /= period;
+        *output++ = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+    }
+    for (; i < size; ++i, ++progress) {
+        const TI_REAL upward = input[i] > last ? input[i] - last : 0;
+        const TI_REAL downward = input[i] < last ? last - input[i] : 0;
+        last = input[i];
+
+        smooth_up = (upward-smooth_up) * per + smooth_up;
+        smooth_down = (downward-smooth_down) * per + smooth_down;
+        *output++ = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+    }
+
+    #undef UPDATE_SUMS
+
+    ptr->progress = progress;
+    ptr->state.last = last;
+    ptr->state.smooth_up = smooth_up;
+    ptr->state.smooth_down = smooth_down;
+
+    return TI_OKAY;
+}
+
+int ti_rsi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_rsi_stream const *ptr = static_cast<ti_rsi_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL input = inputs[0][0];
+    const TI_REAL last = ptr->state.last;
+    const TI_REAL upward = input > last ? input - last : 0;
+    const TI_REAL downward = input < last ? last - input : 0;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL smooth_up, smooth_down;
+    if (ptr->progress == 0) {
+        smooth_up = (ptr->state.smooth_up + upward) / ptr->options.period;
+        smooth_down = (ptr->state.smooth_down + downward) / ptr->options.period;
+    } else {
+        smooth_up = (upward-ptr->state.smooth_up) * per + ptr->state.smooth_up;
+        smooth_down = (downward-ptr->state.smooth_down) * per + ptr->state.smooth_down;
+    }
+    outputs[0][0] = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+
+    return TI_OKAY;
+}
@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_rvi_start(TI_REAL const *options) {
     const TI_REAL ema_period = options[0];
@@ -64,7 +65,7 @@ int ti_rvi(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     return TI_OUT_OF_MEMORY;
 }
 
-struct ti_rvi_stream : ti_stream {
+struct ti_rvi_stream : stream_base {
     struct {
         int ema_period;
         int stddev_period;
@@ -97,6 +98,7 @@ int ti_rvi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_RVI_INDEX;
     ptr->progress = -ti_rvi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.ema_period = ema_period;
     ptr->options.stddev_period = stddev_period;
@@ -123,6 +125,8 @@ void ti_rvi_stream_free(ti_stream *stream) {
     delete static_cast<ti_rvi_stream*>(stream);
 }
 
+STREAM_IO(rvi, s.state.y_sum, s.state.xy_sum, s.state.gains_ema, s.state.losses_ema, s.state.price)
+
 int ti_rvi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_rvi_stream *ptr = static_cast<ti_rvi_stream*>(stream);
 
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_shmma_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -70,7 +71,7 @@ DONTOPTIMIZE int ti_shmma_ref(int size, TI_REAL const *const *inputs, TI_REAL co
     return TI_OKAY;
 }
 
-struct ti_shmma_stream : ti_stream {
+struct ti_shmma_stream : stream_base {
 
     struct {
         int period;
@@ -98,6 +99,7 @@ int ti_shmma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_SHMMA_INDEX;
     ptr->progress = -ti_shmma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -110,6 +112,8 @@ void ti_shmma_stream_free(ti_stream *stream) {
     delete static_cast<ti_shmma_stream*>(stream);
 }
 
+STREAM_IO(shmma, s.state.T, s.state.S, s.state.price)
+
 int ti_shmma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_shmma_stream *ptr = static_cast<ti_shmma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -20,6 +20,8 @@
 #endif
 
 
+#include "../utils/dispatch.h"
+
 #define SIMPLE1(START, FUN, OP) \
 int START(TI_REAL const *options) { \
     (void)options; \
@@ -27,12 +29,14 @@ int START(TI_REAL const *options) { \
 } \
  \
  \
+TI_DISPATCH \
 int FUN(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) { \
     const TI_REAL *in1 = inputs[0]; \
     TI_REAL *output = outputs[0]; \
  \
     (void)options; \
  \
+    TI_SIMD \
     for (int i = 0; i < size; ++i) { \
         output[i] = (OP); \
     } \
@@ -14,6 +14,8 @@
  * (e.g. add, multiply)
  */
 
+#include "../utils/dispatch.h"
+
 #define SIMPLE2(START, FUN, OP) \
 int START(TI_REAL const *options) { \
     (void)options; \
@@ -21,6 +23,7 @@ int START(TI_REAL const *options) { \
 } \
  \
  \
+TI_DISPATCH \
 int FUN(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) { \
     const TI_REAL *in1 = inputs[0]; \
     const TI_REAL *in2 = inputs[1]; \
@@ -30,6 +33,7 @@ int FUN(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL
     TI_REAL *output = outputs[0]; \
  \
     int i; \
+    TI_SIMD \
     for (i = 0; i < size; ++i) { \
         output[i] = (OP); \
     } \
@@ -6,9 +6,13 @@
 
 
 #include <new>
+#include <vector>
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
 
 
 int ti_sma_start(TI_REAL const *options) {
@@ -45,7 +49,39 @@ int ti_sma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
 }
 
 
-struct ti_sma_stream : ti_stream {
+int ti_sma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_sma, 1, size, inputs, options, ti_sma_start(options), first_output, count, outputs);
+}
+
+int ti_sma_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    const TI_REAL shift = input[0];
+    std::vector<TI_REAL> sum(size+1);
+    prefix_sum(size, input, shift, sum.data(), [](int, TI_REAL x) { return x; });
+
+    for (int p = 0; p < nparams; ++p) {
+        const int period = (int)multi_options(options, 1, p)[0];
+        const TI_REAL scale = 1.0 / period;
+        TI_REAL *output = multi_output(outputs, 0, size, p);
+
+        for (int i = period-1; i < size; ++i) {
+            *output++ = (sum[i+1] - sum[i+1-period]) * scale + shift;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+struct ti_sma_stream : stream_base {
     struct {
         int period;
     } options;
@@ -71,6 +107,7 @@ int ti_sma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_SMA_INDEX;
     ptr->progress = -ti_sma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -90,6 +127,8 @@ void ti_sma_stream_free(ti_stream *stream) {
     delete static_cast<ti_sma_stream*>(stream);
 }
 
+STREAM_IO(sma, s.state.sum, s.state.price)
+
 int ti_sma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_sma_stream *ptr = static_cast<ti_sma_stream*>(stream);
     int progress = ptr->progress;
@@ -122,3 +161,99 @@ int ti_sma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs,
 
     return TI_OKAY;
 }
+
+int ti_sma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_sma_stream const *ptr = static_cast<ti_sma_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    /* the state keeps the sum of the last period-1 bars */
+    outputs[0][0] = (ptr->state.sum + inputs[0][0]) * ptr->constants.per;
+
+    return TI_OKAY;
+}
+
+
+struct ti_sma_batch : ti_batch {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        int pos;
+        std::vector<TI_REAL> sum;
+        std::vector<TI_REAL> price; /* period rows of nsymbols, the row at pos is the oldest */
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_sma_batch_new(TI_REAL const *options, int nsymbols, ti_batch **batch) {
+    int period = options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+    if (nsymbols < 1) return TI_INVALID_OPTION;
+
+    ti_sma_batch *ptr = new(std::nothrow) ti_sma_batch();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *batch = ptr;
+
+    ptr->index = TI_INDICATOR_SMA_INDEX;
+    ptr->progress = -ti_sma_start(options);
+    ptr->nsymbols = nsymbols;
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 1. / period;
+
+    try {
+        ptr->state.pos = 0;
+        ptr->state.sum.resize(nsymbols);
+        ptr->state.price.resize((size_t)period * nsymbols);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_sma_batch_free(ti_batch *batch) {
+    delete static_cast<ti_sma_batch*>(batch);
+}
+
+int ti_sma_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_sma_batch *ptr = static_cast<ti_sma_batch*>(batch);
+    const int nsymbols = ptr->nsymbols;
+    const int progress = ptr->progress;
+
+    TI_REAL const *const series = inputs[0];
+    TI_REAL *const sma = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    int pos = ptr->state.pos;
+    TI_REAL *const sum = ptr->state.sum.data();
+    TI_REAL *const oldest = ptr->state.price.data() + (size_t)pos * nsymbols;
+
+    /* The ring is zero-initialized, so the warm-up needs no special casing. */
+    for (int s = 0; s < nsymbols; ++s) {
+        sum[s] += series[s] - oldest[s];
+        oldest[s] = series[s];
+    }
+    if (progress >= 0) {
+        for (int s = 0; s < nsymbols; ++s) {
+            sma[s] = sum[s] * per;
+        }
+    }
+
+    pos += 1;
+    if (pos == period) { pos = 0; }
+
+    ptr->state.pos = pos;
+    ptr->progress = progress + 1;
+
+    return TI_OKAY;
+}
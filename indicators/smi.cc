@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_smi_start(TI_REAL const *options) {
@@ -163,7 +164,7 @@ int ti_smi_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     return TI_OKAY;
 }
 
-struct ti_smi_stream : ti_stream {
+struct ti_smi_stream : stream_base {
     struct {
         int q_period;
         int r_period;
@@ -180,8 +181,8 @@ struct ti_smi_stream : ti_stream {
         int ll_idx = 0;
         int hh_idx = 0;
 
-        ringbuf<0> price_low;
-        ringbuf<0> price_high;
+        ringbuf_minmax<0> price_low;
+        ringbuf_minmax<0> price_high;
     } state;
 
     struct {
@@ -202,6 +203,7 @@ int ti_smi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_SMI_INDEX;
     ptr->progress = -ti_smi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.q_period = q_period;
     ptr->options.r_period = r_period;
@@ -223,6 +225,10 @@ void ti_smi_stream_free(ti_stream *stream) {
     delete static_cast<ti_smi_stream*>(stream);
 }
 
+STREAM_IO(smi,
+    s.state.ema_r_num, s.state.ema_s_num, s.state.ema_r_den, s.state.ema_s_den, s.state.ll,
+    s.state.hh, s.state.ll_idx, s.state.hh_idx, s.state.price_low, s.state.price_high)
+
 int ti_smi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     TI_REAL const *high = inputs[0];
     TI_REAL const *low = inputs[1];
@@ -10,6 +10,7 @@
 #include "../indicators.h"
 #include "../utils/localbuffer.h"
 #include "../utils/log.h"
+#include "../utils/stream.hh"
 
 int ti_ssmooth_start(TI_REAL const *options) {
     return 0;
@@ -43,7 +44,7 @@ int ti_ssmooth(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     return TI_OKAY;
 }
 
-struct ti_ssmooth_stream : ti_stream {
+struct ti_ssmooth_stream : stream_base {
 
     struct {
         
@@ -71,6 +72,7 @@ int ti_ssmooth_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_SSMOOTH_INDEX;
     ptr->progress = -ti_ssmooth_start(options);
+    ptr->keep_options(options);
 
     return TI_OKAY;
 }
@@ -79,6 +81,8 @@ void ti_ssmooth_stream_free(ti_stream *stream) {
     delete static_cast<ti_ssmooth_stream*>(stream);
 }
 
+STREAM_IO(ssmooth, s.state)
+
 int ti_ssmooth_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_ssmooth_stream *ptr = static_cast<ti_ssmooth_stream*>(stream);
     TI_REAL const *series = inputs[0];
@@ -6,8 +6,14 @@
 
 
 #include <new>
+#include <vector>
 
 #include "../indicators.h"
+#include "../utils/moments.hh"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_stddev_start(TI_REAL const *options) {
@@ -54,3 +60,133 @@ int ti_stddev(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     assert(output - outputs[0] == size - ti_stddev_start(options));
     return TI_OKAY;
 }
+
+
+int ti_stddev_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_stddev, 1, size, inputs, options, ti_stddev_start(options), first_output, count, outputs);
+}
+
+int ti_stddev_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    /* variance doesn't depend on the shift */
+    const TI_REAL shift = input[0];
+    std::vector<TI_REAL> sum(size+1);
+    std::vector<TI_REAL> sum2(size+1);
+    prefix_sum(size, input, shift, sum.data(), [](int, TI_REAL x) { return x; });
+    prefix_sum(size, input, shift, sum2.data(), [](int, TI_REAL x) { return x * x; });
+
+    for (int p = 0; p < nparams; ++p) {
+        const int period = (int)multi_options(options, 1, p)[0];
+        const TI_REAL scale = 1.0 / period;
+        TI_REAL *output = multi_output(outputs, 0, size, p);
+
+        for (int i = period-1; i < size; ++i) {
+            const TI_REAL s = (sum[i+1] - sum[i+1-period]) * scale;
+            const TI_REAL s2 = (sum2[i+1] - sum2[i+1-period]) * scale;
+            TI_REAL s2s2 = s2 - s * s;
+            if (s2s2 > 0.0) s2s2 = sqrt(s2s2);
+            *output++ = s2s2;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
+
+
+struct ti_stddev_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        rolling_moments moments;
+        int refresh;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_stddev_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_stddev_stream *ptr = new(std::nothrow) ti_stddev_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_STDDEV_INDEX;
+    ptr->progress = -ti_stddev_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->state.refresh = 1; /* the first full window */
+
+    ptr->constants.per = 1.0 / period;
+
+    try {
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_stddev_stream_free(ti_stream *stream) {
+    delete static_cast<ti_stddev_stream*>(stream);
+}
+
+STREAM_IO(stddev, s.state.moments, s.state.refresh, s.state.price)
+
+int ti_stddev_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_stddev_stream *ptr = static_cast<ti_stddev_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    rolling_moments moments = ptr->state.moments;
+    int refresh = ptr->state.refresh;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = input[i];
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
+        price = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(price, period, per);
+        } else {
+            moments.slide(price, oldest, per);
+        }
+
+        *output++ = sqrt(moments.var(per));
+    }
+
+    ptr->progress = progress;
+    ptr->state.moments = moments;
+    ptr->state.refresh = refresh;
+
+    return TI_OKAY;
+}
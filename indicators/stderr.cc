@@ -8,6 +8,9 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/moments.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_stderr_start(TI_REAL const *options) {
@@ -56,3 +59,97 @@ int ti_stderr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     assert(output - outputs[0] == size - ti_stderr_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_stderr_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        rolling_moments moments;
+        int refresh;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        TI_REAL per;
+        TI_REAL mul;
+    } constants;
+};
+
+
+int ti_stderr_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_stderr_stream *ptr = new(std::nothrow) ti_stderr_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_STDERR_INDEX;
+    ptr->progress = -ti_stderr_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->state.refresh = 1; /* the first full window */
+
+    ptr->constants.per = 1.0 / period;
+    ptr->constants.mul = 1.0 / sqrt(period);
+
+    try {
+        ptr->state.price.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_stderr_stream_free(ti_stream *stream) {
+    delete static_cast<ti_stderr_stream*>(stream);
+}
+
+STREAM_IO(stderr, s.state.moments, s.state.refresh, s.state.price)
+
+int ti_stderr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_stderr_stream *ptr = static_cast<ti_stderr_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+    const TI_REAL mul = ptr->constants.mul;
+
+    rolling_moments moments = ptr->state.moments;
+    int refresh = ptr->state.refresh;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = input[i];
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
+        price = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(price, period, per);
+        } else {
+            moments.slide(price, oldest, per);
+        }
+
+        *output++ = mul * sqrt(moments.var(per));
+    }
+
+    ptr->progress = progress;
+    ptr->state.moments = moments;
+    ptr->state.refresh = refresh;
+
+    return TI_OKAY;
+}
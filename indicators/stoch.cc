@@ -5,8 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_stoch_start(TI_REAL const *options) {
@@ -111,3 +115,143 @@ int ti_stoch(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     return TI_OKAY;
 
 }
+
+
+struct ti_stoch_stream : stream_base {
+    struct {
+        int kperiod;
+        int kslow;
+        int dperiod;
+    } options;
+
+    struct {
+        ringbuf_minmax<0> price_high;
+        ringbuf_minmax<0> price_low;
+        TI_REAL k_sum;
+        TI_REAL d_sum;
+        ringbuf<0> kfast;
+        ringbuf<0> k;
+    } state;
+
+    struct {
+        TI_REAL kper;
+        TI_REAL dper;
+    } constants;
+};
+
+
+int ti_stoch_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int kperiod = (int)options[0];
+    const int kslow = (int)options[1];
+    const int dperiod = (int)options[2];
+    if (kperiod < 1) return TI_INVALID_OPTION;
+    if (kslow < 1) return TI_INVALID_OPTION;
+    if (dperiod < 1) return TI_INVALID_OPTION;
+
+    ti_stoch_stream *ptr = new(std::nothrow) ti_stoch_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_STOCH_INDEX;
+    ptr->progress = -ti_stoch_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.kperiod = kperiod;
+    ptr->options.kslow = kslow;
+    ptr->options.dperiod = dperiod;
+
+    ptr->constants.kper = 1.0 / kslow;
+    ptr->constants.dper = 1.0 / dperiod;
+
+    try {
+        ptr->state.price_high.resize(kperiod);
+        ptr->state.price_low.resize(kperiod);
+        ptr->state.kfast.resize(kslow);
+        ptr->state.k.resize(dperiod);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_stoch_stream_free(ti_stream *stream) {
+    delete static_cast<ti_stoch_stream*>(stream);
+}
+
+STREAM_IO(stoch,
+    s.state.price_high, s.state.price_low, s.state.k_sum, s.state.d_sum, s.state.kfast, s.state.k)
+
+int ti_stoch_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_stoch_stream *ptr = static_cast<ti_stoch_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *stoch = outputs[0];
+    TI_REAL *stoch_ma = outputs[1];
+
+    const int kperiod = ptr->options.kperiod;
+    const int dperiod = ptr->options.dperiod;
+    const TI_REAL kper = ptr->constants.kper;
+    const TI_REAL dper = ptr->constants.dper;
+
+    TI_REAL k_sum = ptr->state.k_sum;
+    TI_REAL d_sum = ptr->state.d_sum;
+    auto &price_high = ptr->state.price_high;
+    auto &price_low = ptr->state.price_low;
+    auto &kfast = ptr->state.kfast;
+    auto &k = ptr->state.k;
+
+    /* like the batch loop, kfast is computed from the first bar on, over the bars seen so far;
+       the rings start zeroed, so dropping their oldest value is a no-op until they are full */
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price_high, price_low, kfast)) {
+        price_high = high[i];
+        price_low = low[i];
+
+        const TI_REAL max = *price_high.find_max(kperiod);
+        const TI_REAL min = *price_low.find_min(kperiod);
+        const TI_REAL kdiff = (max - min);
+        const TI_REAL fast = kdiff == 0.0 ? 0.0 : 100 * ((close[i] - min) / kdiff);
+        k_sum -= kfast;
+        k_sum += fast;
+        kfast = fast;
+
+        if (progress >= -(dperiod-1)) {
+            const TI_REAL slow = k_sum * kper;
+            d_sum -= k;
+            d_sum += slow;
+            k = slow;
+            step(k);
+        }
+    }
+    for (; i < size; ++i, ++progress, step(price_high, price_low, kfast, k)) {
+        price_high = high[i];
+        price_low = low[i];
+
+        const TI_REAL max = *price_high.find_max(kperiod);
+        const TI_REAL min = *price_low.find_min(kperiod);
+        const TI_REAL kdiff = (max - min);
+        const TI_REAL fast = kdiff == 0.0 ? 0.0 : 100 * ((close[i] - min) / kdiff);
+        k_sum -= kfast;
+        k_sum += fast;
+        kfast = fast;
+
+        const TI_REAL slow = k_sum * kper;
+        d_sum -= k;
+        d_sum += slow;
+        k = slow;
+
+        *stoch++ = slow;
+        *stoch_ma++ = d_sum * dper;
+    }
+
+    ptr->progress = progress;
+    ptr->state.k_sum = k_sum;
+    ptr->state.d_sum = d_sum;
+
+    return TI_OKAY;
+}
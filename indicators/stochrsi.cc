@@ -5,8 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_stochrsi_start(TI_REAL const *options) {
@@ -100,3 +104,121 @@ int ti_stochrsi(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     assert(output - outputs[0] == size - ti_stochrsi_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_stochrsi_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL last;
+        TI_REAL smooth_up;
+        TI_REAL smooth_down;
+        ringbuf_minmax<0> rsi;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_stochrsi_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 2) return TI_INVALID_OPTION;
+
+    ti_stochrsi_stream *ptr = new(std::nothrow) ti_stochrsi_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_STOCHRSI_INDEX;
+    ptr->progress = -ti_stochrsi_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 1.0 / ((TI_REAL)period);
+
+    try {
+        ptr->state.rsi.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_stochrsi_stream_free(ti_stream *stream) {
+    delete static_cast<ti_stochrsi_stream*>(stream);
+}
+
+STREAM_IO(stochrsi, s.state.last, s.state.smooth_up, s.state.smooth_down, s.state.rsi)
+
+int ti_stochrsi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_stochrsi_stream *ptr = static_cast<ti_stochrsi_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL last = ptr->state.last;
+    TI_REAL smooth_up = ptr->state.smooth_up;
+    TI_REAL smooth_down = ptr->state.smooth_down;
+    auto &rsi = ptr->state.rsi;
+
+    /* the rsi of the bars period..2*period-2 only fill the window */
+    int i = 0;
+    for (; i < size && progress == -(period*2-1); ++i, ++progress) {
+        last = input[i];
+    }
+    for (; i < size && progress <= -(period-1); ++i, ++progress) {
+        const TI_REAL upward = input[i] > last ? input[i] - last : 0;
+        const TI_REAL downward = input[i] < last ? last - input[i] : 0;
+        smooth_up += upward;
+        smooth_down += downward;
+        last = input[i];
+
+        if (progress == -(period-1)) {
+            smooth_up /= period;
+            smooth_down /= period;
+            rsi = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+            step(rsi);
+        }
+    }
+    for (; i < size && progress < 0; ++i, ++progress, step(rsi)) {
+        const TI_REAL upward = input[i] > last ? input[i] - last : 0;
+        const TI_REAL downward = input[i] < last ? last - input[i] : 0;
+        smooth_up = (upward-smooth_up) * per + smooth_up;
+        smooth_down = (downward-smooth_down) * per + smooth_down;
+        last = input[i];
+
+        rsi = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+    }
+    for (; i < size; ++i, ++progress, step(rsi)) {
+        const TI_REAL upward = input[i] > last ? input[i] - last : 0;
+        const TI_REAL downward = input[i] < last ? last - input[i] : 0;
+        smooth_up = (upward-smooth_up) * per + smooth_up;
+        smooth_down = (downward-smooth_down) * per + smooth_down;
+        last = input[i];
+
+        const TI_REAL r = smooth_up ? 100.0 * (smooth_up / (smooth_up + smooth_down)) : 0;
+        rsi = r;
+
+        const TI_REAL max = *rsi.find_max(period);
+        const TI_REAL min = *rsi.find_min(period);
+        const TI_REAL diff = max - min;
+        *output++ = diff == 0.0 ? 0.0 : (r - min) / (diff);
+    }
+
+    ptr->progress = progress;
+    ptr->state.last = last;
+    ptr->state.smooth_up = smooth_up;
+    ptr->state.smooth_down = smooth_down;
+
+    return TI_OKAY;
+}
@@ -5,7 +5,12 @@
  */
 
 
+#include <new>
+#include <vector>
+
 #include "../indicators.h"
+#include "../utils/multi.hh"
+#include "../utils/range.hh"
 
 
 int ti_sum_start(TI_REAL const *options) {
@@ -39,3 +44,35 @@ int ti_sum(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_RE
     assert(output - outputs[0] == size - ti_sum_start(options));
     return TI_OKAY;
 }
+
+
+int ti_sum_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_sum, 1, size, inputs, options, ti_sum_start(options), first_output, count, outputs);
+}
+
+int ti_sum_multi(int size, TI_REAL const *const *inputs, TI_REAL const *options, int nparams, TI_REAL *const *outputs) try {
+    const TI_REAL *input = inputs[0];
+
+    for (int p = 0; p < nparams; ++p) {
+        if ((int)multi_options(options, 1, p)[0] < 1) return TI_INVALID_OPTION;
+    }
+    if (size < 1) return TI_OKAY;
+
+    const TI_REAL shift = input[0];
+    std::vector<TI_REAL> sum(size+1);
+    prefix_sum(size, input, shift, sum.data(), [](int, TI_REAL x) { return x; });
+
+    for (int p = 0; p < nparams; ++p) {
+        const int period = (int)multi_options(options, 1, p)[0];
+        const TI_REAL shift_sum = shift * period;
+        TI_REAL *output = multi_output(outputs, 0, size, p);
+
+        for (int i = period-1; i < size; ++i) {
+            *output++ = (sum[i+1] - sum[i+1-period]) + shift_sum;
+        }
+    }
+
+    return TI_OKAY;
+} catch (std::bad_alloc& e) {
+    return TI_OUT_OF_MEMORY;
+}
@@ -10,6 +10,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_swma_start(TI_REAL const *options) {
     const int period = options[0];
@@ -34,6 +35,44 @@ static TI_REAL table[] = {
     sin(12. * PI / 6),
 };
 
+static TI_REAL cos_table[] = {
+    cos( 1. * PI / 6),
+    cos( 2. * PI / 6),
+    cos( 3. * PI / 6),
+    cos( 4. * PI / 6),
+    cos( 5. * PI / 6),
+    cos( 6. * PI / 6),
+    cos( 7. * PI / 6),
+    cos( 8. * PI / 6),
+    cos( 9. * PI / 6),
+    cos(10. * PI / 6),
+    cos(11. * PI / 6),
+    cos(12. * PI / 6),
+};
+
+/* The numerator is the imaginary part of X_i = sum_j x_{i-j} w^(j+1), w = e^(i*PI/6), which slides as
+ * X_i = w (X_{i-1} + x_i - w^period x_{i-period}). Every period bars it is recomputed over the window
+ * to drop the rounding accumulated by the rotations.
+ */
+
+static void swma_refresh(TI_REAL const *newest, int period, TI_REAL *rp, TI_REAL *ip) {
+    *rp = 0;
+    *ip = 0;
+    for (int j = 0; j < period; ++j) {
+        *rp += cos_table[j%12] * newest[-j];
+        *ip += table[j%12] * newest[-j];
+    }
+}
+
+static void swma_refresh(ringbuf<0> const &price, int period, TI_REAL *rp, TI_REAL *ip) {
+    *rp = 0;
+    *ip = 0;
+    for (int j = 0; j < period; ++j) {
+        *rp += cos_table[j%12] * price[j];
+        *ip += table[j%12] * price[j];
+    }
+}
+
 int ti_swma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     TI_REAL const *const series = inputs[0];
     const int period = options[0];
@@ -44,17 +83,27 @@ int ti_swma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
 
     TI_REAL denom = 0;
     for (int j = 0; j < period; ++j) {
-        TI_REAL c = table[j%12];
-        denom += c;
+        denom += table[j%12];
     }
-
-    for (int i = period-1; i < size; ++i) {
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            TI_REAL c = table[j%12];
-            numer += c * series[i-j];
+    const TI_REAL wr = cos_table[0], wi = table[0];
+    const TI_REAL wpr = cos_table[(period-1)%12], wpi = table[(period-1)%12];
+
+    TI_REAL rp = 0, ip = 0;
+    int refresh = period;
+
+    for (int i = 0; i < size; ++i) {
+        if (--refresh == 0) {
+            refresh = period;
+            swma_refresh(series + i, period, &rp, &ip);
+        } else {
+            const TI_REAL oldest = i >= period ? series[i-period] : 0;
+            const TI_REAL rp_ = rp + series[i] - wpr * oldest;
+            const TI_REAL ip_ = ip - wpi * oldest;
+            rp = wr * rp_ - wi * ip_;
+            ip = wr * ip_ + wi * rp_;
         }
-        *swma++ = numer / denom;
+
+        if (i >= period-1) { *swma++ = ip / denom; }
     }
 
     return TI_OKAY;
@@ -82,13 +131,16 @@ DONTOPTIMIZE int ti_swma_ref(int size, TI_REAL const *const *inputs, TI_REAL con
     return TI_OKAY;
 }
 
-struct ti_swma_stream : ti_stream {
+struct ti_swma_stream : stream_base {
 
     struct {
         int period;
     } options;
 
     struct {
+        TI_REAL rp;
+        TI_REAL ip;
+        int refresh;
         ringbuf<0> price;
     } state;
 
@@ -109,19 +161,24 @@ int ti_swma_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_SWMA_INDEX;
     ptr->progress = -ti_swma_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
     try {
         ptr->state.price.resize(period);
     } catch (std::bad_alloc& e) {
+        delete ptr;
         return TI_OUT_OF_MEMORY;
     }
 
+    ptr->state.rp = 0;
+    ptr->state.ip = 0;
+    ptr->state.refresh = period;
+
     ptr->constants.denom = 0;
     for (int j = 0; j < period; ++j) {
-        TI_REAL c = table[j%12];
-        ptr->constants.denom += c;
+        ptr->constants.denom += table[j%12];
     }
 
     return TI_OKAY;
@@ -131,6 +188,8 @@ void ti_swma_stream_free(ti_stream *stream) {
     delete static_cast<ti_swma_stream*>(stream);
 }
 
+STREAM_IO(swma, s.state.rp, s.state.ip, s.state.refresh, s.state.price)
+
 int ti_swma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_swma_stream *ptr = static_cast<ti_swma_stream*>(stream);
     TI_REAL const *const series = inputs[0];
@@ -138,23 +197,34 @@ int ti_swma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs
     int progress = ptr->progress;
     const int period = ptr->options.period;
     const TI_REAL denom = ptr->constants.denom;
+    TI_REAL rp = ptr->state.rp;
+    TI_REAL ip = ptr->state.ip;
+    int refresh = ptr->state.refresh;
     auto &price = ptr->state.price;
+    const TI_REAL wr = cos_table[0], wi = table[0];
+    const TI_REAL wpr = cos_table[(period-1)%12], wpi = table[(period-1)%12];
 
-    int i = 0;
-    for (; progress < 0 && i < size; ++i, ++progress, step(price)) {
+    for (int i = 0; i < size; ++i, ++progress, step(price)) {
+        const TI_REAL oldest = price;
         price = series[i];
-    }
-    for (; i < size; ++i, ++progress, step(price)) {
-        price = series[i];
-        TI_REAL numer = 0;
-        for (int j = 0; j < period; ++j) {
-            TI_REAL c = table[j%12];
-            numer += c * price[j];
+
+        if (--refresh == 0) {
+            refresh = period;
+            swma_refresh(price, period, &rp, &ip);
+        } else {
+            const TI_REAL rp_ = rp + series[i] - wpr * oldest;
+            const TI_REAL ip_ = ip - wpi * oldest;
+            rp = wr * rp_ - wi * ip_;
+            ip = wr * ip_ + wi * rp_;
         }
-        *swma++ = numer / denom;
+
+        if (progress >= 0) { *swma++ = ip / denom; }
     }
 
     ptr->progress = progress;
+    ptr->state.rp = rp;
+    ptr->state.ip = ip;
+    ptr->state.refresh = refresh;
 
     return TI_OKAY;
 }
@@ -11,6 +11,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_t3_start(TI_REAL const *options) {
@@ -114,7 +115,7 @@ DONTOPTIMIZE int ti_t3_ref(int size, TI_REAL const *const *inputs, TI_REAL const
     return TI_OKAY;
 }
 
-struct ti_t3_stream : ti_stream {
+struct ti_t3_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -153,6 +154,7 @@ int ti_t3_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_T3_INDEX;
     ptr->progress = -ti_t3_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
     ptr->options.v = v;
@@ -164,6 +166,8 @@ void ti_t3_stream_free(ti_stream *stream) {
     delete static_cast<ti_t3_stream*>(stream);
 }
 
+STREAM_IO(t3, s.state)
+
 int ti_t3_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_t3_stream *ptr = static_cast<ti_t3_stream*>(stream);
     TI_REAL const *const series = inputs[0];
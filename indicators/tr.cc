@@ -8,6 +8,7 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/dispatch.h"
 #include "truerange.h"
 
 
@@ -18,6 +19,7 @@ int ti_tr_start(TI_REAL const *options) {
 }
 
 
+TI_DISPATCH
 int ti_tr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
     const TI_REAL *high = inputs[0];
     const TI_REAL *low = inputs[1];
@@ -26,14 +28,14 @@ int ti_tr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_REA
     (void)options;
 
     TI_REAL *output = outputs[0];
-    TI_REAL truerange;
 
 
-    int i = 0;
-    for (; i < 1 && i < size; ++i) {
-        output[i] = high[i] - low[i];
+    if (size > 0) {
+        output[0] = high[0] - low[0];
     }
-    for (; i < size; ++i) {
+    TI_SIMD
+    for (int i = 1; i < size; ++i) {
+        TI_REAL truerange;
         CALC_TRUERANGE();
         output[i] = truerange;
     }
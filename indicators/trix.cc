@@ -5,7 +5,10 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 
 int ti_trix_start(TI_REAL const *options) {
@@ -59,3 +62,100 @@ int ti_trix(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     return TI_OKAY;
 
 }
+
+
+struct ti_trix_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL ema1;
+        TI_REAL ema2;
+        TI_REAL ema3;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_trix_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_trix_stream *ptr = new(std::nothrow) ti_trix_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_TRIX_INDEX;
+    ptr->progress = -ti_trix_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 2 / ((TI_REAL)period + 1);
+
+    return TI_OKAY;
+}
+
+void ti_trix_stream_free(ti_stream *stream) {
+    delete static_cast<ti_trix_stream*>(stream);
+}
+
+STREAM_IO(trix, s.state)
+
+int ti_trix_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_trix_stream *ptr = static_cast<ti_trix_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const int start = (period*3)-2;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL ema1 = ptr->state.ema1;
+    TI_REAL ema2 = ptr->state.ema2;
+    TI_REAL ema3 = ptr->state.ema3;
+
+    /* the bar index of the batch loop is progress + start */
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        const int bar = progress + start;
+        if (bar == 0) {
+            ema1 = input[i];
+            continue;
+        }
+
+        ema1 = (input[i]-ema1) * per + ema1;
+
+        if (bar == period-1) {
+            ema2 = ema1;
+        } else if (bar > period-1) {
+            ema2 = (ema1-ema2) * per + ema2;
+
+            if (bar == period * 2 - 2) {
+                ema3 = ema2;
+            } else if (bar > period * 2 - 2) {
+                ema3 = (ema2-ema3) * per + ema3;
+            }
+        }
+    }
+    for (; i < size; ++i, ++progress) {
+        ema1 = (input[i]-ema1) * per + ema1;
+        ema2 = (ema1-ema2) * per + ema2;
+        const TI_REAL last = ema3;
+        ema3 = (ema2-ema3) * per + ema3;
+        *output++ = ema3 ? (ema3-last)/ema3 * 100.0 : 0;
+    }
+
+    ptr->progress = progress;
+    ptr->state.ema1 = ema1;
+    ptr->state.ema2 = ema2;
+    ptr->state.ema3 = ema3;
+
+    return TI_OKAY;
+}
@@ -6,15 +6,23 @@
 
 
 
+#ifndef __TRUERANGE_H__
+#define __TRUERANGE_H__
+
+
+/* The true range of a bar given the close of the one before */
+static inline TI_REAL truerange_of(TI_REAL h, TI_REAL l, TI_REAL prev_close) {
+    const TI_REAL ych = fabs(h - prev_close);
+    const TI_REAL ycl = fabs(l - prev_close);
+    TI_REAL v = h - l;
+    if (ych > v) v = ych;
+    if (ycl > v) v = ycl;
+    return v;
+}
+
 #define CALC_TRUERANGE() do{\
-        const TI_REAL l = low[i];\
-        const TI_REAL h = high[i];\
-        const TI_REAL c = close[i-1];\
-        const TI_REAL ych = fabs(h - c);\
-        const TI_REAL ycl = fabs(l - c);\
-        TI_REAL v = h - l;\
-        if (ych > v) v = ych;\
-        if (ycl > v) v = ycl;\
-        truerange = v;\
+        truerange = truerange_of(high[i], low[i], close[i-1]);\
 }while(0)
 
+
+#endif /*__TRUERANGE_H__*/
@@ -7,6 +7,7 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/stream.hh"
 
 int ti_tsi_start(TI_REAL const *options) {
     return 1;
@@ -90,7 +91,7 @@ int ti_tsi_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     return TI_OKAY;
 }
 
-struct ti_tsi_stream : ti_stream {
+struct ti_tsi_stream : stream_base {
 
     struct {
         TI_REAL y_period;
@@ -117,6 +118,7 @@ int ti_tsi_stream_new(TI_REAL const *options, ti_stream **stream) {
     
     ptr->index = TI_INDICATOR_TSI_INDEX;
     ptr->progress = -ti_tsi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.y_period = y_period;
     ptr->options.z_period = z_period;
@@ -128,6 +130,8 @@ void ti_tsi_stream_free(ti_stream *stream) {
     delete static_cast<ti_tsi_stream*>(stream);
 }
 
+STREAM_IO(tsi, s.state)
+
 int ti_tsi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_tsi_stream *ptr = static_cast<ti_tsi_stream*>(stream);
     TI_REAL const *series = inputs[0];
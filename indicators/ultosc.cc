@@ -5,9 +5,13 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
 #include "../utils/buffer.h"
 #include "../utils/minmax.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_ultosc_start(TI_REAL const *options) {
@@ -32,11 +36,14 @@ int ti_ultosc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     if (size <= ti_ultosc_start(options)) return TI_OKAY;
 
 
-    ti_buffer *bp_buf = ti_buffer_new(long_period);
-    ti_buffer *r_buf = ti_buffer_new(long_period);
+    /* one extra slot, so that the value leaving the long window is still there
+     * when medium_period or short_period equals long_period */
+    ti_buffer *bp_buf = ti_buffer_new(long_period+1);
+    ti_buffer *r_buf = ti_buffer_new(long_period+1);
 
     TI_REAL bp_short_sum = 0, bp_medium_sum = 0;
     TI_REAL r_short_sum = 0, r_medium_sum = 0;
+    TI_REAL bp_long_sum = 0, r_long_sum = 0;
 
     int i;
     for (i = 1; i < size; ++i) {
@@ -48,32 +55,40 @@ int ti_ultosc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
 
         bp_short_sum += bp;
         bp_medium_sum += bp;
+        bp_long_sum += bp;
         r_short_sum += r;
         r_medium_sum += r;
+        r_long_sum += r;
 
-        ti_buffer_push(bp_buf, bp);
-        ti_buffer_push(r_buf, r);
+        ti_buffer_qpush(bp_buf, bp);
+        ti_buffer_qpush(r_buf, r);
 
-        /* The long sum takes care of itself, but we're piggy-backing
-         * the medium and short sums off the same buffers. */
+        /* The three sums are piggy-backing off the same buffers. */
         if (i > short_period) {
             int short_index = bp_buf->index - short_period - 1;
-            if (short_index < 0) short_index += long_period;
+            if (short_index < 0) short_index += long_period+1;
             bp_short_sum -= bp_buf->vals[short_index];
             r_short_sum -= r_buf->vals[short_index];
 
             if (i > medium_period) {
                 int medium_index = bp_buf->index - medium_period - 1;
-                if (medium_index < 0) medium_index += long_period;
+                if (medium_index < 0) medium_index += long_period+1;
                 bp_medium_sum -= bp_buf->vals[medium_index];
                 r_medium_sum -= r_buf->vals[medium_index];
+
+                if (i > long_period) {
+                    int long_index = bp_buf->index - long_period - 1;
+                    if (long_index < 0) long_index += long_period+1;
+                    bp_long_sum -= bp_buf->vals[long_index];
+                    r_long_sum -= r_buf->vals[long_index];
+                }
             }
         }
 
         if (i >= long_period) {
             const TI_REAL first = bp_short_sum ? 4 * bp_short_sum / r_short_sum : 0;
             const TI_REAL second = bp_medium_sum ? 2 * bp_medium_sum / r_medium_sum : 0;
-            const TI_REAL third = bp_buf->sum ? 1 * bp_buf->sum / r_buf->sum : 0;
+            const TI_REAL third = bp_long_sum ? 1 * bp_long_sum / r_long_sum : 0;
             const TI_REAL ult = (first + second + third) * 100.0 / 7.0;
             *output++ = ult;
         }
@@ -88,3 +103,133 @@ int ti_ultosc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI
     return TI_OKAY;
 
 }
+
+
+struct ti_ultosc_stream : stream_base {
+    struct {
+        int short_period;
+        int medium_period;
+        int long_period;
+    } options;
+
+    struct {
+        TI_REAL last;
+        TI_REAL bp_short_sum, bp_medium_sum, bp_long_sum;
+        TI_REAL r_short_sum, r_medium_sum, r_long_sum;
+        ringbuf<0> bp_buf;
+        ringbuf<0> r_buf;
+    } state;
+};
+
+
+int ti_ultosc_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int medium_period = (int)options[1];
+    const int long_period = (int)options[2];
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (medium_period < short_period) return TI_INVALID_OPTION;
+    if (long_period < medium_period) return TI_INVALID_OPTION;
+
+    ti_ultosc_stream *ptr = new(std::nothrow) ti_ultosc_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_ULTOSC_INDEX;
+    ptr->progress = -ti_ultosc_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.medium_period = medium_period;
+    ptr->options.long_period = long_period;
+
+    /* one extra slot, so that the value leaving each of the three windows is still there */
+    try {
+        ptr->state.bp_buf.resize(long_period+1);
+        ptr->state.r_buf.resize(long_period+1);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_ultosc_stream_free(ti_stream *stream) {
+    delete static_cast<ti_ultosc_stream*>(stream);
+}
+
+STREAM_IO(ultosc,
+    s.state.last, s.state.bp_short_sum, s.state.bp_medium_sum, s.state.bp_long_sum,
+    s.state.r_short_sum, s.state.r_medium_sum, s.state.r_long_sum, s.state.bp_buf, s.state.r_buf)
+
+int ti_ultosc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_ultosc_stream *ptr = static_cast<ti_ultosc_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *output = outputs[0];
+
+    const int short_period = ptr->options.short_period;
+    const int medium_period = ptr->options.medium_period;
+    const int long_period = ptr->options.long_period;
+
+    TI_REAL last = ptr->state.last;
+    TI_REAL bp_short_sum = ptr->state.bp_short_sum;
+    TI_REAL bp_medium_sum = ptr->state.bp_medium_sum;
+    TI_REAL bp_long_sum = ptr->state.bp_long_sum;
+    TI_REAL r_short_sum = ptr->state.r_short_sum;
+    TI_REAL r_medium_sum = ptr->state.r_medium_sum;
+    TI_REAL r_long_sum = ptr->state.r_long_sum;
+    auto &bp_buf = ptr->state.bp_buf;
+    auto &r_buf = ptr->state.r_buf;
+
+    int i = 0;
+    for (; i < size && progress == -long_period; ++i, ++progress) {
+        last = close[i];
+    }
+    for (; i < size; ++i, ++progress, step(bp_buf, r_buf)) {
+        const TI_REAL true_low = MIN(low[i], last);
+        const TI_REAL true_high = MAX(high[i], last);
+        const TI_REAL bp = close[i] - true_low;
+        const TI_REAL r = true_high - true_low;
+        last = close[i];
+
+        bp_short_sum += bp;
+        bp_medium_sum += bp;
+        bp_long_sum += bp;
+        r_short_sum += r;
+        r_medium_sum += r;
+        r_long_sum += r;
+
+        bp_buf = bp;
+        r_buf = r;
+
+        /* the rings start zeroed, so this is a no-op until the windows are full */
+        bp_short_sum -= bp_buf[short_period];
+        bp_medium_sum -= bp_buf[medium_period];
+        bp_long_sum -= bp_buf[long_period];
+        r_short_sum -= r_buf[short_period];
+        r_medium_sum -= r_buf[medium_period];
+        r_long_sum -= r_buf[long_period];
+
+        if (progress >= 0) {
+            const TI_REAL first = bp_short_sum ? 4 * bp_short_sum / r_short_sum : 0;
+            const TI_REAL second = bp_medium_sum ? 2 * bp_medium_sum / r_medium_sum : 0;
+            const TI_REAL third = bp_long_sum ? 1 * bp_long_sum / r_long_sum : 0;
+            *output++ = (first + second + third) * 100.0 / 7.0;
+        }
+    }
+
+    ptr->progress = progress;
+    ptr->state.last = last;
+    ptr->state.bp_short_sum = bp_short_sum;
+    ptr->state.bp_medium_sum = bp_medium_sum;
+    ptr->state.bp_long_sum = bp_long_sum;
+    ptr->state.r_short_sum = r_short_sum;
+    ptr->state.r_medium_sum = r_medium_sum;
+    ptr->state.r_long_sum = r_long_sum;
+
+    return TI_OKAY;
+}
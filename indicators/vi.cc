@@ -12,6 +12,7 @@
 #include "../utils/log.h"
 #include "../utils/minmax.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_vi_start(TI_REAL const *options) {
     const TI_REAL period = options[0];
@@ -101,7 +102,7 @@ DONTOPTIMIZE int ti_vi_ref(int size, TI_REAL const *const *inputs, TI_REAL const
     return TI_OKAY;
 }
 
-struct ti_vi_stream : ti_stream {
+struct ti_vi_stream : stream_base {
 
     struct {
         TI_REAL period;
@@ -133,6 +134,7 @@ int ti_vi_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_VI_INDEX;
     ptr->progress = -ti_vi_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -143,6 +145,14 @@ void ti_vi_stream_free(ti_stream *stream) {
     delete static_cast<ti_vi_stream*>(stream);
 }
 
+/* the three stories go in step and hold at most period+1 bars */
+static bool stream_valid(ti_vi_stream const &s) {
+    const size_t n = s.high_story.size();
+    return s.low_story.size() == n && s.close_story.size() == n && n <= s.options.period + 1;
+}
+
+STREAM_IO(vi, s.state, s.high_story, s.low_story, s.close_story)
+
 int ti_vi_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_vi_stream *ptr = static_cast<ti_vi_stream*>(stream);
     TI_REAL const *const high = inputs[0];
@@ -8,6 +8,9 @@
 #include <new>
 
 #include "../indicators.h"
+#include "../utils/moments.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 #define CHANGE(i) (input[i-1] ? input[i]/input[i-1]-1.0 : 0)
 
@@ -56,3 +59,105 @@ int ti_volatility(int size, TI_REAL const *const *inputs, TI_REAL const *options
     return TI_OKAY;
 
 }
+
+
+struct ti_volatility_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL last;
+        rolling_moments moments;
+        int refresh;
+        ringbuf<0> change;
+    } state;
+
+    struct {
+        TI_REAL scale;
+        TI_REAL annual;
+    } constants;
+};
+
+
+int ti_volatility_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_volatility_stream *ptr = new(std::nothrow) ti_volatility_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_VOLATILITY_INDEX;
+    ptr->progress = -ti_volatility_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->state.refresh = 1; /* the first full window */
+
+    ptr->constants.scale = 1.0 / period;
+    ptr->constants.annual = sqrt(252);
+
+    try {
+        ptr->state.change.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_volatility_stream_free(ti_stream *stream) {
+    delete static_cast<ti_volatility_stream*>(stream);
+}
+
+STREAM_IO(volatility, s.state.last, s.state.moments, s.state.refresh, s.state.change)
+
+int ti_volatility_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_volatility_stream *ptr = static_cast<ti_volatility_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL scale = ptr->constants.scale;
+    const TI_REAL annual = ptr->constants.annual;
+
+    TI_REAL last = ptr->state.last;
+    rolling_moments moments = ptr->state.moments;
+    int refresh = ptr->state.refresh;
+    auto &change = ptr->state.change;
+
+    int i = 0;
+    for (; i < size && progress == -period; ++i, ++progress) {
+        last = input[i];
+    }
+    for (; i < size && progress < 0; ++i, ++progress, step(change)) {
+        change = last ? input[i]/last-1.0 : 0;
+        last = input[i];
+    }
+    for (; i < size; ++i, ++progress, step(change)) {
+        const TI_REAL oldest = change;
+        change = last ? input[i]/last-1.0 : 0;
+        last = input[i];
+
+        if (--refresh == 0) {
+            refresh = period;
+            moments.refresh(change, period, scale);
+        } else {
+            moments.slide(change, oldest, scale);
+        }
+
+        *output++ = sqrt(moments.var(scale)) * annual;
+    }
+
+    ptr->progress = progress;
+    ptr->state.last = last;
+    ptr->state.moments = moments;
+    ptr->state.refresh = refresh;
+
+    return TI_OKAY;
+}
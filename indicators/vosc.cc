@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_vosc_start(TI_REAL const *options) {
@@ -59,3 +63,111 @@ int ti_vosc(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(output - outputs[0] == size - ti_vosc_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_vosc_stream : stream_base {
+    struct {
+        int short_period;
+        int long_period;
+    } options;
+
+    struct {
+        TI_REAL short_sum;
+        TI_REAL long_sum;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        TI_REAL short_div;
+        TI_REAL long_div;
+    } constants;
+};
+
+
+int ti_vosc_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int short_period = (int)options[0];
+    const int long_period = (int)options[1];
+
+    if (short_period < 1) return TI_INVALID_OPTION;
+    if (long_period < short_period) return TI_INVALID_OPTION;
+
+    ti_vosc_stream *ptr = new(std::nothrow) ti_vosc_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_VOSC_INDEX;
+    ptr->progress = -ti_vosc_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.short_period = short_period;
+    ptr->options.long_period = long_period;
+
+    ptr->constants.short_div = 1.0 / short_period;
+    ptr->constants.long_div = 1.0 / long_period;
+
+    try {
+        ptr->state.price.resize(long_period+1);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_vosc_stream_free(ti_stream *stream) {
+    delete static_cast<ti_vosc_stream*>(stream);
+}
+
+STREAM_IO(vosc, s.state.short_sum, s.state.long_sum, s.state.price)
+
+int ti_vosc_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_vosc_stream *ptr = static_cast<ti_vosc_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int short_period = ptr->options.short_period;
+    const int long_period = ptr->options.long_period;
+    const TI_REAL short_div = ptr->constants.short_div;
+    const TI_REAL long_div = ptr->constants.long_div;
+
+    TI_REAL short_sum = ptr->state.short_sum;
+    TI_REAL long_sum = ptr->state.long_sum;
+    auto &price = ptr->state.price;
+
+    /* the bar index of the batch loop is progress + long_period-1 */
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress, step(price)) {
+        price = input[i];
+        if (progress + short_period > 0) {
+            short_sum += price;
+        }
+        long_sum += price;
+
+        if (progress == 0) {
+            const TI_REAL savg = short_sum * short_div;
+            const TI_REAL lavg = long_sum * long_div;
+            *output++ = (savg - lavg) ? 100.0 * (savg - lavg) / lavg : 0;
+        }
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        price = input[i];
+        short_sum += price;
+        short_sum -= price[short_period];
+
+        long_sum += price;
+        long_sum -= price[long_period];
+
+        const TI_REAL savg = short_sum * short_div;
+        const TI_REAL lavg = long_sum * long_div;
+        *output++ = (savg - lavg) ? 100.0 * (savg - lavg) / lavg : 0;
+    }
+
+    ptr->progress = progress;
+    ptr->state.short_sum = short_sum;
+    ptr->state.long_sum = long_sum;
+
+    return TI_OKAY;
+}
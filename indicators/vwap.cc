@@ -8,6 +8,7 @@
 
 #include "../indicators.h"
 #include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 int ti_vwap_start(TI_REAL const *options) {
     return (int)options[0]-1;
@@ -88,7 +89,7 @@ int ti_vwap_ref(int size, TI_REAL const *const *inputs, TI_REAL const *options,
     return TI_OKAY;
 }
 
-struct ti_vwap_stream : ti_stream {
+struct ti_vwap_stream : stream_base {
     struct {
         int period;
     } options;
@@ -118,6 +119,7 @@ int ti_vwap_stream_new(TI_REAL const *options, ti_stream **stream) {
 
     ptr->index = TI_INDICATOR_VWAP_INDEX;
     ptr->progress = -ti_vwap_start(options);
+    ptr->keep_options(options);
 
     ptr->options.period = period;
 
@@ -141,6 +143,10 @@ void ti_vwap_stream_free(ti_stream *stream) {
     delete static_cast<ti_vwap_stream*>(stream);
 }
 
+STREAM_IO(vwap,
+    s.state.num, s.state.den, s.state.price_high, s.state.price_low, s.state.price_close,
+    s.state.price_volume)
+
 int ti_vwap_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
     ti_vwap_stream *ptr = static_cast<ti_vwap_stream*>(stream);
 
@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_vwma_start(TI_REAL const *options) {
@@ -47,3 +51,93 @@ int ti_vwma(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_R
     assert(output - outputs[0] == size - ti_vwma_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_vwma_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL sum;
+        TI_REAL vsum;
+        ringbuf<0> weighted;
+        ringbuf<0> volume;
+    } state;
+};
+
+
+int ti_vwma_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_vwma_stream *ptr = new(std::nothrow) ti_vwma_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_VWMA_INDEX;
+    ptr->progress = -ti_vwma_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.weighted.resize(period);
+        ptr->state.volume.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_vwma_stream_free(ti_stream *stream) {
+    delete static_cast<ti_vwma_stream*>(stream);
+}
+
+STREAM_IO(vwma, s.state.sum, s.state.vsum, s.state.weighted, s.state.volume)
+
+int ti_vwma_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_vwma_stream *ptr = static_cast<ti_vwma_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    const TI_REAL *volume = inputs[1];
+    TI_REAL *output = outputs[0];
+
+    TI_REAL sum = ptr->state.sum;
+    TI_REAL vsum = ptr->state.vsum;
+    auto &weighted = ptr->state.weighted;
+    auto &volumes = ptr->state.volume;
+
+    int i = 0;
+    for (; i < size && progress <= 0; ++i, ++progress, step(weighted), step(volumes)) {
+        weighted = input[i] * volume[i];
+        volumes = volume[i];
+        sum += weighted;
+        vsum += volumes;
+
+        if (progress == 0) {
+            *output++ = sum ? sum / vsum : 0;
+        }
+    }
+    for (; i < size; ++i, ++progress, step(weighted), step(volumes)) {
+        /* before the assignment, the rings hold the bar of period bars ago */
+        sum += input[i] * volume[i];
+        sum -= weighted;
+        vsum += volume[i];
+        vsum -= volumes;
+
+        weighted = input[i] * volume[i];
+        volumes = volume[i];
+
+        *output++ = sum ? sum / vsum : 0;
+    }
+
+    ptr->progress = progress;
+    ptr->state.sum = sum;
+    ptr->state.vsum = vsum;
+
+    return TI_OKAY;
+}
@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/range.hh"
+#include "../utils/stream.hh"
 
 
 int ti_wilders_start(TI_REAL const *options) {
@@ -43,3 +47,129 @@ int ti_wilders(int size, TI_REAL const *const *inputs, TI_REAL const *options, T
     assert(output - outputs[0] == size - ti_wilders_start(options));
     return TI_OKAY;
 }
+
+
+int ti_wilders_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    const TI_REAL *input = inputs[0];
+    const int period = (int)options[0];
+    TI_REAL *output = outputs[0];
+
+    if (period < 1) return TI_INVALID_OPTION;
+    if (!range_check(size, ti_wilders_start(options), first_output, count)) return TI_INVALID_OPTION;
+    if (count == 0) return TI_OKAY;
+
+    const TI_REAL per = 1.0 / ((TI_REAL)period);
+
+    TI_REAL sum = 0;
+
+    int i;
+    for (i = 0; i < period; ++i) {
+        sum += input[i];
+    }
+
+    TI_REAL val = sum / period;
+
+    const int first = period-1 + first_output;
+    for (; i <= first; ++i) {
+        val = (input[i]-val) * per + val;
+    }
+    *output++ = val;
+
+    for (; i < first + count; ++i) {
+        val = (input[i]-val) * per + val;
+        *output++ = val;
+    }
+
+    assert(output - outputs[0] == count);
+    return TI_OKAY;
+}
+
+
+struct ti_wilders_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL sum;
+        TI_REAL val;
+    } state;
+
+    struct {
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_wilders_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_wilders_stream *ptr = new(std::nothrow) ti_wilders_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_WILDERS_INDEX;
+    ptr->progress = -ti_wilders_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.per = 1.0 / ((TI_REAL)period);
+
+    return TI_OKAY;
+}
+
+void ti_wilders_stream_free(ti_stream *stream) {
+    delete static_cast<ti_wilders_stream*>(stream);
+}
+
+STREAM_IO(wilders, s.state)
+
+int ti_wilders_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_wilders_stream *ptr = static_cast<ti_wilders_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL sum = ptr->state.sum;
+    TI_REAL val = ptr->state.val;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress) {
+        sum += input[i];
+    }
+    for (; i < size && progress == 0; ++i, ++progress) {
+        sum += input[i];
+        val = sum / period;
+        *output++ = val;
+    }
+    for (; i < size; ++i, ++progress) {
+        val = (input[i]-val) * per + val;
+        *output++ = val;
+    }
+
+    ptr->progress = progress;
+    ptr->state.sum = sum;
+    ptr->state.val = val;
+
+    return TI_OKAY;
+}
+
+int ti_wilders_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_wilders_stream const *ptr = static_cast<ti_wilders_stream const*>(stream);
+    if (ptr->progress < 0) { return TI_OKAY; }
+
+    const TI_REAL val = ptr->state.val;
+    if (ptr->progress == 0) {
+        outputs[0][0] = (ptr->state.sum + inputs[0][0]) / ptr->options.period;
+    } else {
+        outputs[0][0] = (inputs[0][0]-val) * ptr->constants.per + val;
+    }
+
+    return TI_OKAY;
+}
@@ -5,7 +5,12 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/range.hh"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_willr_start(TI_REAL const *options) {
@@ -81,3 +86,87 @@ int ti_willr(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
 
 
 }
+
+
+int ti_willr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return range_window(ti_willr, 3, size, inputs, options, ti_willr_start(options), first_output, count, outputs);
+}
+
+
+struct ti_willr_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        ringbuf_minmax<0> price_high;
+        ringbuf_minmax<0> price_low;
+    } state;
+};
+
+
+int ti_willr_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    if (period < 1) return TI_INVALID_OPTION;
+
+    ti_willr_stream *ptr = new(std::nothrow) ti_willr_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_WILLR_INDEX;
+    ptr->progress = -ti_willr_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    try {
+        ptr->state.price_high.resize(period);
+        ptr->state.price_low.resize(period);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_willr_stream_free(ti_stream *stream) {
+    delete static_cast<ti_willr_stream*>(stream);
+}
+
+STREAM_IO(willr, s.state.price_high, s.state.price_low)
+
+int ti_willr_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_willr_stream *ptr = static_cast<ti_willr_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *high = inputs[0];
+    const TI_REAL *low = inputs[1];
+    const TI_REAL *close = inputs[2];
+    TI_REAL *output = outputs[0];
+
+    const int period = ptr->options.period;
+
+    auto &price_high = ptr->state.price_high;
+    auto &price_low = ptr->state.price_low;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price_high, price_low)) {
+        price_high = high[i];
+        price_low = low[i];
+    }
+    for (; i < size; ++i, ++progress, step(price_high, price_low)) {
+        price_high = high[i];
+        price_low = low[i];
+
+        const TI_REAL max = *price_high.find_max(period);
+        const TI_REAL min = *price_low.find_min(period);
+
+        const TI_REAL highlow = (max - min);
+        *output++ = highlow == 0.0 ? 0.0 : -100 * ((max - close[i]) / highlow);
+    }
+
+    ptr->progress = progress;
+
+    return TI_OKAY;
+}
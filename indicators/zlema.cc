@@ -5,7 +5,11 @@
  */
 
 
+#include <new>
+
 #include "../indicators.h"
+#include "../utils/ringbuf.hh"
+#include "../utils/stream.hh"
 
 
 int ti_zlema_start(TI_REAL const *options) {
@@ -22,6 +26,7 @@ int ti_zlema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     TI_REAL *output = outputs[0];
 
     if (period < 1) return TI_INVALID_OPTION;
+    if (lag < 1) return TI_INVALID_OPTION; /* the first value would be the bar before the first one */
     if (size <= ti_zlema_start(options)) return TI_OKAY;
 
     const TI_REAL per = 2 / ((TI_REAL)period + 1);
@@ -42,3 +47,93 @@ int ti_zlema(int size, TI_REAL const *const *inputs, TI_REAL const *options, TI_
     assert(output - outputs[0] == size - ti_zlema_start(options));
     return TI_OKAY;
 }
+
+
+struct ti_zlema_stream : stream_base {
+    struct {
+        int period;
+    } options;
+
+    struct {
+        TI_REAL val;
+        ringbuf<0> price;
+    } state;
+
+    struct {
+        int lag;
+        TI_REAL per;
+    } constants;
+};
+
+
+int ti_zlema_stream_new(TI_REAL const *options, ti_stream **stream) {
+    const int period = (int)options[0];
+    const int lag = (period - 1) / 2;
+    if (period < 1) return TI_INVALID_OPTION;
+    if (lag < 1) return TI_INVALID_OPTION;
+
+    ti_zlema_stream *ptr = new(std::nothrow) ti_zlema_stream();
+    if (!ptr) { return TI_OUT_OF_MEMORY; }
+    *stream = ptr;
+
+    ptr->index = TI_INDICATOR_ZLEMA_INDEX;
+    ptr->progress = -ti_zlema_start(options);
+    ptr->keep_options(options);
+
+    ptr->options.period = period;
+
+    ptr->constants.lag = lag;
+    ptr->constants.per = 2 / ((TI_REAL)period + 1);
+
+    try {
+        ptr->state.price.resize(lag+1);
+    } catch (std::bad_alloc& e) {
+        delete ptr;
+        return TI_OUT_OF_MEMORY;
+    }
+
+    return TI_OKAY;
+}
+
+void ti_zlema_stream_free(ti_stream *stream) {
+    delete static_cast<ti_zlema_stream*>(stream);
+}
+
+STREAM_IO(zlema, s.state.val, s.state.price)
+
+int ti_zlema_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    ti_zlema_stream *ptr = static_cast<ti_zlema_stream*>(stream);
+    int progress = ptr->progress;
+
+    const TI_REAL *input = inputs[0];
+    TI_REAL *output = outputs[0];
+
+    const int lag = ptr->constants.lag;
+    const TI_REAL per = ptr->constants.per;
+
+    TI_REAL val = ptr->state.val;
+    auto &price = ptr->state.price;
+
+    int i = 0;
+    for (; i < size && progress < 0; ++i, ++progress, step(price)) {
+        price = input[i];
+    }
+    for (; i < size && progress == 0; ++i, ++progress, step(price)) {
+        price = input[i];
+        val = price;
+        *output++ = val;
+    }
+    for (; i < size; ++i, ++progress, step(price)) {
+        price = input[i];
+        TI_REAL c = price;
+        TI_REAL l = price[lag];
+
+        val = ((c + (c-l))-val) * per + val;
+        *output++ = val;
+    }
+
+    ptr->progress = progress;
+    ptr->state.val = val;
+
+    return TI_OKAY;
+}
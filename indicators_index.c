@@ -0,0 +1,1018 @@
+#include "indicators.h"
+const char* ti_version() { return TI_VERSION; }
+long int ti_build() { return TI_BUILD; }
+int ti_indicator_count() { return TI_INDICATOR_COUNT; }
+
+struct ti_indicator_info ti_indicators[] = {
+{"abands", "Acceleration Bands", ti_abands_start, ti_abands, ti_abands_ref, TI_TYPE_INDICATOR, 3, 1, 3, {"high", "low", "close", 0}, {"period", 0}, {"abands_lower", "abands_upper", "abands_middle", 0}, 0, 0, 0, 0, 0, 0, 0, ti_abands_range, 0, 0, 0, 0, 0},
+{"abs", "Vector Absolute Value", ti_abs_start, ti_abs, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"abs", 0}, 0, 0, 0, 0, 0, 0, 0, ti_abs_range, 0, 0, 0, 0, 0},
+{"acos", "Vector Arccosine", ti_acos_start, ti_acos, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"acos", 0}, 0, 0, 0, 0, 0, 0, 0, ti_acos_range, 0, 0, 0, 0, 0},
+{"ad", "Accumulation/Distribution Line", ti_ad_start, ti_ad, 0, TI_TYPE_INDICATOR, 4, 0, 1, {"high", "low", "close", "volume", 0}, {0}, {"ad", 0}, ti_ad_stream_new, ti_ad_stream_run, ti_ad_stream_free, 0, 0, 0, 0, ti_ad_range, ti_ad_stream_save, ti_ad_stream_load, ti_ad_stream_clone, ti_ad_stream_clone_into, ti_ad_stream_peek},
+{"add", "Vector Addition", ti_add_start, ti_add, 0, TI_TYPE_SIMPLE, 2, 0, 1, {"series", "series", 0}, {0}, {"add", 0}, 0, 0, 0, 0, 0, 0, 0, ti_add_range, 0, 0, 0, 0, 0},
+{"adosc", "Accumulation/Distribution Oscillator", ti_adosc_start, ti_adosc, 0, TI_TYPE_INDICATOR, 4, 2, 1, {"high", "low", "close", "volume", 0}, {"short period", "long period", 0}, {"adosc", 0}, ti_adosc_stream_new, ti_adosc_stream_run, ti_adosc_stream_free, 0, 0, 0, 0, ti_adosc_range, ti_adosc_stream_save, ti_adosc_stream_load, ti_adosc_stream_clone, ti_adosc_stream_clone_into, ti_adosc_stream_peek},
+{"adx", "Average Directional Movement Index", ti_adx_start, ti_adx, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"adx", 0}, ti_adx_stream_new, ti_adx_stream_run, ti_adx_stream_free, 0, 0, 0, 0, ti_adx_range, ti_adx_stream_save, ti_adx_stream_load, ti_adx_stream_clone, ti_adx_stream_clone_into, ti_adx_stream_peek},
+{"adxr", "Average Directional Movement Rating", ti_adxr_start, ti_adxr, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"adxr", 0}, ti_adxr_stream_new, ti_adxr_stream_run, ti_adxr_stream_free, 0, 0, 0, 0, ti_adxr_range, ti_adxr_stream_save, ti_adxr_stream_load, ti_adxr_stream_clone, ti_adxr_stream_clone_into, ti_adxr_stream_peek},
+{"ahma", "Ahrens Moving Average", ti_ahma_start, ti_ahma, ti_ahma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"ahma", 0}, ti_ahma_stream_new, ti_ahma_stream_run, ti_ahma_stream_free, 0, 0, 0, 0, ti_ahma_range, ti_ahma_stream_save, ti_ahma_stream_load, ti_ahma_stream_clone, ti_ahma_stream_clone_into, ti_ahma_stream_peek},
+{"ao", "Awesome Oscillator", ti_ao_start, ti_ao, 0, TI_TYPE_INDICATOR, 2, 0, 1, {"high", "low", 0}, {0}, {"ao", 0}, 0, 0, 0, 0, 0, 0, 0, ti_ao_range, 0, 0, 0, 0, 0},
+{"apo", "Absolute Price Oscillator", ti_apo_start, ti_apo, 0, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"short period", "long period", 0}, {"apo", 0}, ti_apo_stream_new, ti_apo_stream_run, ti_apo_stream_free, 0, 0, 0, 0, ti_apo_range, ti_apo_stream_save, ti_apo_stream_load, ti_apo_stream_clone, ti_apo_stream_clone_into, ti_apo_stream_peek},
+{"aroon", "Aroon", ti_aroon_start, ti_aroon, 0, TI_TYPE_INDICATOR, 2, 1, 2, {"high", "low", 0}, {"period", 0}, {"aroon_down", "aroon_up", 0}, ti_aroon_stream_new, ti_aroon_stream_run, ti_aroon_stream_free, 0, 0, 0, 0, ti_aroon_range, ti_aroon_stream_save, ti_aroon_stream_load, ti_aroon_stream_clone, ti_aroon_stream_clone_into, ti_aroon_stream_peek},
+{"aroonosc", "Aroon Oscillator", ti_aroonosc_start, ti_aroonosc, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"aroonosc", 0}, ti_aroonosc_stream_new, ti_aroonosc_stream_run, ti_aroonosc_stream_free, 0, 0, 0, 0, ti_aroonosc_range, ti_aroonosc_stream_save, ti_aroonosc_stream_load, ti_aroonosc_stream_clone, ti_aroonosc_stream_clone_into, ti_aroonosc_stream_peek},
+{"arsi", "Adaptive Relative Strength Index", ti_arsi_start, ti_arsi, ti_arsi_ref, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"cycpart", 0}, {"arsi", 0}, ti_arsi_stream_new, ti_arsi_stream_run, ti_arsi_stream_free, 0, 0, 0, 0, ti_arsi_range, ti_arsi_stream_save, ti_arsi_stream_load, ti_arsi_stream_clone, ti_arsi_stream_clone_into, ti_arsi_stream_peek},
+{"asin", "Vector Arcsine", ti_asin_start, ti_asin, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"asin", 0}, 0, 0, 0, 0, 0, 0, 0, ti_asin_range, 0, 0, 0, 0, 0},
+{"atan", "Vector Arctangent", ti_atan_start, ti_atan, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"atan", 0}, 0, 0, 0, 0, 0, 0, 0, ti_atan_range, 0, 0, 0, 0, 0},
+{"atr", "Average True Range", ti_atr_start, ti_atr, ti_atr_ref, TI_TYPE_INDICATOR, 3, 1, 1, {"high", "low", "close", 0}, {"period", 0}, {"atr", 0}, ti_atr_stream_new, ti_atr_stream_run, ti_atr_stream_free, ti_atr_batch_new, ti_atr_batch_run, ti_atr_batch_free, ti_atr_multi, ti_atr_range, ti_atr_stream_save, ti_atr_stream_load, ti_atr_stream_clone, ti_atr_stream_clone_into, ti_atr_stream_peek},
+{"avgprice", "Average Price", ti_avgprice_start, ti_avgprice, 0, TI_TYPE_OVERLAY, 4, 0, 1, {"open", "high", "low", "close", 0}, {0}, {"avgprice", 0}, 0, 0, 0, 0, 0, 0, 0, ti_avgprice_range, 0, 0, 0, 0, 0},
+{"bbands", "Bollinger Bands", ti_bbands_start, ti_bbands, 0, TI_TYPE_OVERLAY, 1, 2, 3, {"series", 0}, {"period", "stddev", 0}, {"bbands_lower", "bbands_middle", "bbands_upper", 0}, ti_bbands_stream_new, ti_bbands_stream_run, ti_bbands_stream_free, 0, 0, 0, 0, ti_bbands_range, ti_bbands_stream_save, ti_bbands_stream_load, ti_bbands_stream_clone, ti_bbands_stream_clone_into, ti_bbands_stream_peek},
+{"bf2", "Butterworth Filter - 2 Poles", ti_bf2_start, ti_bf2, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"bf2", 0}, ti_bf2_stream_new, ti_bf2_stream_run, ti_bf2_stream_free, 0, 0, 0, 0, ti_bf2_range, ti_bf2_stream_save, ti_bf2_stream_load, ti_bf2_stream_clone, ti_bf2_stream_clone_into, ti_bf2_stream_peek},
+{"bf3", "Butterworth Filter - 3 Poles", ti_bf3_start, ti_bf3, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"bf3", 0}, ti_bf3_stream_new, ti_bf3_stream_run, ti_bf3_stream_free, 0, 0, 0, 0, ti_bf3_range, ti_bf3_stream_save, ti_bf3_stream_load, ti_bf3_stream_clone, ti_bf3_stream_clone_into, ti_bf3_stream_peek},
+{"bop", "Balance of Power", ti_bop_start, ti_bop, 0, TI_TYPE_INDICATOR, 4, 0, 1, {"open", "high", "low", "close", 0}, {0}, {"bop", 0}, 0, 0, 0, 0, 0, 0, 0, ti_bop_range, 0, 0, 0, 0, 0},
+{"cci", "Commodity Channel Index", ti_cci_start, ti_cci, ti_cci_ref, TI_TYPE_INDICATOR, 3, 1, 1, {"high", "low", "close", 0}, {"period", 0}, {"cci", 0}, ti_cci_stream_new, ti_cci_stream_run, ti_cci_stream_free, 0, 0, 0, 0, ti_cci_range, ti_cci_stream_save, ti_cci_stream_load, ti_cci_stream_clone, ti_cci_stream_clone_into, ti_cci_stream_peek},
+{"ce", "Chandelier Exit", ti_ce_start, ti_ce, ti_ce_ref, TI_TYPE_INDICATOR, 3, 2, 2, {"high", "low", "close", 0}, {"period", "coef", 0}, {"ce_high", "ce_low", 0}, ti_ce_stream_new, ti_ce_stream_run, ti_ce_stream_free, 0, 0, 0, 0, ti_ce_range, ti_ce_stream_save, ti_ce_stream_load, ti_ce_stream_clone, ti_ce_stream_clone_into, ti_ce_stream_peek},
+{"ceil", "Vector Ceiling", ti_ceil_start, ti_ceil, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"ceil", 0}, 0, 0, 0, 0, 0, 0, 0, ti_ceil_range, 0, 0, 0, 0, 0},
+{"cmf", "Chaikin Money Flow", ti_cmf_start, ti_cmf, 0, TI_TYPE_INDICATOR, 4, 1, 1, {"high", "low", "close", "volume", 0}, {"period", 0}, {"cmf", 0}, ti_cmf_stream_new, ti_cmf_stream_run, ti_cmf_stream_free, 0, 0, 0, 0, ti_cmf_range, ti_cmf_stream_save, ti_cmf_stream_load, ti_cmf_stream_clone, ti_cmf_stream_clone_into, ti_cmf_stream_peek},
+{"cmi", "Choppy Market Indicator", ti_cmi_start, ti_cmi, ti_cmi_ref, TI_TYPE_INDICATOR, 3, 1, 1, {"high", "low", "close", 0}, {"period", 0}, {"cmi", 0}, ti_cmi_stream_new, ti_cmi_stream_run, ti_cmi_stream_free, 0, 0, 0, 0, ti_cmi_range, ti_cmi_stream_save, ti_cmi_stream_load, ti_cmi_stream_clone, ti_cmi_stream_clone_into, ti_cmi_stream_peek},
+{"cmo", "Chande Momentum Oscillator", ti_cmo_start, ti_cmo, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"cmo", 0}, 0, 0, 0, 0, 0, 0, 0, ti_cmo_range, 0, 0, 0, 0, 0},
+{"copp", "Coppock Curve", ti_copp_start, ti_copp, ti_copp_ref, TI_TYPE_INDICATOR, 1, 3, 1, {"series", 0}, {"roc_shorter_period", "roc_longer_period", "wma_period", 0}, {"copp", 0}, ti_copp_stream_new, ti_copp_stream_run, ti_copp_stream_free, 0, 0, 0, 0, ti_copp_range, ti_copp_stream_save, ti_copp_stream_load, ti_copp_stream_clone, ti_copp_stream_clone_into, ti_copp_stream_peek},
+{"cos", "Vector Cosine", ti_cos_start, ti_cos, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"cos", 0}, 0, 0, 0, 0, 0, 0, 0, ti_cos_range, 0, 0, 0, 0, 0},
+{"cosh", "Vector Hyperbolic Cosine", ti_cosh_start, ti_cosh, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"cosh", 0}, 0, 0, 0, 0, 0, 0, 0, ti_cosh_range, 0, 0, 0, 0, 0},
+{"crossany", "Crossany", ti_crossany_start, ti_crossany, 0, TI_TYPE_MATH, 2, 0, 1, {"series", "series", 0}, {0}, {"crossany", 0}, 0, 0, 0, 0, 0, 0, 0, ti_crossany_range, 0, 0, 0, 0, 0},
+{"crossover", "Crossover", ti_crossover_start, ti_crossover, 0, TI_TYPE_MATH, 2, 0, 1, {"series", "series", 0}, {0}, {"crossover", 0}, 0, 0, 0, 0, 0, 0, 0, ti_crossover_range, 0, 0, 0, 0, 0},
+{"cvi", "Chaikins Volatility", ti_cvi_start, ti_cvi, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"cvi", 0}, ti_cvi_stream_new, ti_cvi_stream_run, ti_cvi_stream_free, 0, 0, 0, 0, ti_cvi_range, ti_cvi_stream_save, ti_cvi_stream_load, ti_cvi_stream_clone, ti_cvi_stream_clone_into, ti_cvi_stream_peek},
+{"decay", "Linear Decay", ti_decay_start, ti_decay, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"decay", 0}, 0, 0, 0, 0, 0, 0, 0, ti_decay_range, 0, 0, 0, 0, 0},
+{"dema", "Double Exponential Moving Average", ti_dema_start, ti_dema, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"dema", 0}, ti_dema_stream_new, ti_dema_stream_run, ti_dema_stream_free, 0, 0, 0, 0, ti_dema_range, ti_dema_stream_save, ti_dema_stream_load, ti_dema_stream_clone, ti_dema_stream_clone_into, ti_dema_stream_peek},
+{"di", "Directional Indicator", ti_di_start, ti_di, 0, TI_TYPE_INDICATOR, 3, 1, 2, {"high", "low", "close", 0}, {"period", 0}, {"plus_di", "minus_di", 0}, ti_di_stream_new, ti_di_stream_run, ti_di_stream_free, 0, 0, 0, 0, ti_di_range, ti_di_stream_save, ti_di_stream_load, ti_di_stream_clone, ti_di_stream_clone_into, ti_di_stream_peek},
+{"div", "Vector Division", ti_div_start, ti_div, 0, TI_TYPE_SIMPLE, 2, 0, 1, {"series", "series", 0}, {0}, {"div", 0}, 0, 0, 0, 0, 0, 0, 0, ti_div_range, 0, 0, 0, 0, 0},
+{"dm", "Directional Movement", ti_dm_start, ti_dm, 0, TI_TYPE_INDICATOR, 2, 1, 2, {"high", "low", 0}, {"period", 0}, {"plus_dm", "minus_dm", 0}, ti_dm_stream_new, ti_dm_stream_run, ti_dm_stream_free, 0, 0, 0, 0, ti_dm_range, ti_dm_stream_save, ti_dm_stream_load, ti_dm_stream_clone, ti_dm_stream_clone_into, ti_dm_stream_peek},
+{"dpo", "Detrended Price Oscillator", ti_dpo_start, ti_dpo, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"dpo", 0}, 0, 0, 0, 0, 0, 0, 0, ti_dpo_range, 0, 0, 0, 0, 0},
+{"dwma", "Double Weighted Moving Average", ti_dwma_start, ti_dwma, ti_dwma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"dwma", 0}, ti_dwma_stream_new, ti_dwma_stream_run, ti_dwma_stream_free, 0, 0, 0, 0, ti_dwma_range, ti_dwma_stream_save, ti_dwma_stream_load, ti_dwma_stream_clone, ti_dwma_stream_clone_into, ti_dwma_stream_peek},
+{"dx", "Directional Movement Index", ti_dx_start, ti_dx, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"dx", 0}, ti_dx_stream_new, ti_dx_stream_run, ti_dx_stream_free, 0, 0, 0, 0, ti_dx_range, ti_dx_stream_save, ti_dx_stream_load, ti_dx_stream_clone, ti_dx_stream_clone_into, ti_dx_stream_peek},
+{"edcf", "Ehlers Distance Coefficient Filter", ti_edcf_start, ti_edcf, ti_edcf_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"length", 0}, {"edcf", 0}, ti_edcf_stream_new, ti_edcf_stream_run, ti_edcf_stream_free, 0, 0, 0, 0, ti_edcf_range, ti_edcf_stream_save, ti_edcf_stream_load, ti_edcf_stream_clone, ti_edcf_stream_clone_into, ti_edcf_stream_peek},
+{"edecay", "Exponential Decay", ti_edecay_start, ti_edecay, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"edecay", 0}, 0, 0, 0, 0, 0, 0, 0, ti_edecay_range, 0, 0, 0, 0, 0},
+{"ehma", "Exponential Hull Moving Average", ti_ehma_start, ti_ehma, ti_ehma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"ehma", 0}, ti_ehma_stream_new, ti_ehma_stream_run, ti_ehma_stream_free, 0, 0, 0, 0, ti_ehma_range, ti_ehma_stream_save, ti_ehma_stream_load, ti_ehma_stream_clone, ti_ehma_stream_clone_into, ti_ehma_stream_peek},
+{"ema", "Exponential Moving Average", ti_ema_start, ti_ema, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"ema", 0}, ti_ema_stream_new, ti_ema_stream_run, ti_ema_stream_free, 0, 0, 0, ti_ema_multi, ti_ema_range, ti_ema_stream_save, ti_ema_stream_load, ti_ema_stream_clone, ti_ema_stream_clone_into, ti_ema_stream_peek},
+{"emsd", "Exponential Moving Standard Deviation", ti_emsd_start, ti_emsd, ti_emsd_ref, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "ma_period", 0}, {"emsd", 0}, ti_emsd_stream_new, ti_emsd_stream_run, ti_emsd_stream_free, 0, 0, 0, 0, ti_emsd_range, ti_emsd_stream_save, ti_emsd_stream_load, ti_emsd_stream_clone, ti_emsd_stream_clone_into, ti_emsd_stream_peek},
+{"emv", "Ease of Movement", ti_emv_start, ti_emv, 0, TI_TYPE_INDICATOR, 3, 0, 1, {"high", "low", "volume", 0}, {0}, {"emv", 0}, ti_emv_stream_new, ti_emv_stream_run, ti_emv_stream_free, 0, 0, 0, 0, ti_emv_range, ti_emv_stream_save, ti_emv_stream_load, ti_emv_stream_clone, ti_emv_stream_clone_into, ti_emv_stream_peek},
+{"er", "Efficiency Ratio", ti_er_start, ti_er, ti_er_ref, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"er", 0}, ti_er_stream_new, ti_er_stream_run, ti_er_stream_free, 0, 0, 0, 0, ti_er_range, ti_er_stream_save, ti_er_stream_load, ti_er_stream_clone, ti_er_stream_clone_into, ti_er_stream_peek},
+{"evwma", "Elastic Volume Weighted Moving Average", ti_evwma_start, ti_evwma, ti_evwma_ref, TI_TYPE_OVERLAY, 2, 2, 1, {"close", "volume", 0}, {"period", "gamma", 0}, {"evwma", 0}, ti_evwma_stream_new, ti_evwma_stream_run, ti_evwma_stream_free, 0, 0, 0, 0, ti_evwma_range, ti_evwma_stream_save, ti_evwma_stream_load, ti_evwma_stream_clone, ti_evwma_stream_clone_into, ti_evwma_stream_peek},
+{"exp", "Vector Exponential", ti_exp_start, ti_exp, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"exp", 0}, 0, 0, 0, 0, 0, 0, 0, ti_exp_range, 0, 0, 0, 0, 0},
+{"fi", "Force Index", ti_fi_start, ti_fi, ti_fi_ref, TI_TYPE_INDICATOR, 2, 1, 1, {"close", "volume", 0}, {"period", 0}, {"fi", 0}, ti_fi_stream_new, ti_fi_stream_run, ti_fi_stream_free, ti_fi_batch_new, ti_fi_batch_run, ti_fi_batch_free, 0, ti_fi_range, ti_fi_stream_save, ti_fi_stream_load, ti_fi_stream_clone, ti_fi_stream_clone_into, ti_fi_stream_peek},
+{"fisher", "Fisher Transform", ti_fisher_start, ti_fisher, 0, TI_TYPE_INDICATOR, 2, 1, 2, {"high", "low", 0}, {"period", 0}, {"fisher", "fisher_signal", 0}, ti_fisher_stream_new, ti_fisher_stream_run, ti_fisher_stream_free, 0, 0, 0, 0, ti_fisher_range, ti_fisher_stream_save, ti_fisher_stream_load, ti_fisher_stream_clone, ti_fisher_stream_clone_into, ti_fisher_stream_peek},
+{"floor", "Vector Floor", ti_floor_start, ti_floor, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"floor", 0}, 0, 0, 0, 0, 0, 0, 0, ti_floor_range, 0, 0, 0, 0, 0},
+{"fosc", "Forecast Oscillator", ti_fosc_start, ti_fosc, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"fosc", 0}, 0, 0, 0, 0, 0, 0, 0, ti_fosc_range, 0, 0, 0, 0, 0},
+{"frama", "Fractal Adaptive Moving Average", ti_frama_start, ti_frama, ti_frama_ref, TI_TYPE_OVERLAY, 2, 2, 1, {"high", "low", 0}, {"period", "average_period", 0}, {"frama", 0}, ti_frama_stream_new, ti_frama_stream_run, ti_frama_stream_free, 0, 0, 0, 0, ti_frama_range, ti_frama_stream_save, ti_frama_stream_load, ti_frama_stream_clone, ti_frama_stream_clone_into, ti_frama_stream_peek},
+{"gf1", "Gaussian Filter - 1 Pole", ti_gf1_start, ti_gf1, ti_gf1_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"gf1", 0}, ti_gf1_stream_new, ti_gf1_stream_run, ti_gf1_stream_free, 0, 0, 0, 0, ti_gf1_range, ti_gf1_stream_save, ti_gf1_stream_load, ti_gf1_stream_clone, ti_gf1_stream_clone_into, ti_gf1_stream_peek},
+{"gf2", "Gaussian Filter - 2 Poles", ti_gf2_start, ti_gf2, ti_gf2_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"gf2", 0}, ti_gf2_stream_new, ti_gf2_stream_run, ti_gf2_stream_free, 0, 0, 0, 0, ti_gf2_range, ti_gf2_stream_save, ti_gf2_stream_load, ti_gf2_stream_clone, ti_gf2_stream_clone_into, ti_gf2_stream_peek},
+{"gf3", "Gaussian Filter - 3 Poles", ti_gf3_start, ti_gf3, ti_gf3_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"gf3", 0}, ti_gf3_stream_new, ti_gf3_stream_run, ti_gf3_stream_free, 0, 0, 0, 0, ti_gf3_range, ti_gf3_stream_save, ti_gf3_stream_load, ti_gf3_stream_clone, ti_gf3_stream_clone_into, ti_gf3_stream_peek},
+{"gf4", "Gaussian Filter - 4 Poles", ti_gf4_start, ti_gf4, ti_gf4_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"gf4", 0}, ti_gf4_stream_new, ti_gf4_stream_run, ti_gf4_stream_free, 0, 0, 0, 0, ti_gf4_range, ti_gf4_stream_save, ti_gf4_stream_load, ti_gf4_stream_clone, ti_gf4_stream_clone_into, ti_gf4_stream_peek},
+{"hd", "Homodyne Discriminator", ti_hd_start, ti_hd, ti_hd_ref, TI_TYPE_INDICATOR, 1, 0, 1, {"series", 0}, {0}, {"hd", 0}, ti_hd_stream_new, ti_hd_stream_run, ti_hd_stream_free, 0, 0, 0, 0, ti_hd_range, ti_hd_stream_save, ti_hd_stream_load, ti_hd_stream_clone, ti_hd_stream_clone_into, ti_hd_stream_peek},
+{"hf", "Hampel Filter", ti_hf_start, ti_hf, ti_hf_ref, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "threshold", 0}, {"hf", 0}, ti_hf_stream_new, ti_hf_stream_run, ti_hf_stream_free, 0, 0, 0, 0, ti_hf_range, ti_hf_stream_save, ti_hf_stream_load, ti_hf_stream_clone, ti_hf_stream_clone_into, ti_hf_stream_peek},
+{"hfema", "Hampel Filter on Exponential Moving Average", ti_hfema_start, ti_hfema, ti_hfema_ref, TI_TYPE_OVERLAY, 1, 3, 1, {"series", 0}, {"ema_period", "k", "threshold", 0}, {"hfema", 0}, ti_hfema_stream_new, ti_hfema_stream_run, ti_hfema_stream_free, 0, 0, 0, 0, ti_hfema_range, ti_hfema_stream_save, ti_hfema_stream_load, ti_hfema_stream_clone, ti_hfema_stream_clone_into, ti_hfema_stream_peek},
+{"hfsma", "Hampel Filter on Simple Moving Average", ti_hfsma_start, ti_hfsma, ti_hfsma_ref, TI_TYPE_OVERLAY, 1, 3, 1, {"series", 0}, {"sma_period", "k", "threshold", 0}, {"hfsma", 0}, ti_hfsma_stream_new, ti_hfsma_stream_run, ti_hfsma_stream_free, 0, 0, 0, 0, ti_hfsma_range, ti_hfsma_stream_save, ti_hfsma_stream_load, ti_hfsma_stream_clone, ti_hfsma_stream_clone_into, ti_hfsma_stream_peek},
+{"hma", "Hull Moving Average", ti_hma_start, ti_hma, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"hma", 0}, 0, 0, 0, 0, 0, 0, 0, ti_hma_range, 0, 0, 0, 0, 0},
+{"hurst", "Hurst Exponent Indicator", ti_hurst_start, ti_hurst, ti_hurst_ref, TI_TYPE_INDICATOR, 1, 1, 2, {"series", 0}, {"period", 0}, {"hurst", "fractal_dim", 0}, ti_hurst_stream_new, ti_hurst_stream_run, ti_hurst_stream_free, 0, 0, 0, 0, ti_hurst_range, ti_hurst_stream_save, ti_hurst_stream_load, ti_hurst_stream_clone, ti_hurst_stream_clone_into, ti_hurst_stream_peek},
+{"hwma", "Henderson asymmetric filter", ti_hwma_start, ti_hwma, ti_hwma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"hwma", 0}, ti_hwma_stream_new, ti_hwma_stream_run, ti_hwma_stream_free, 0, 0, 0, 0, ti_hwma_range, ti_hwma_stream_save, ti_hwma_stream_load, ti_hwma_stream_clone, ti_hwma_stream_clone_into, ti_hwma_stream_peek},
+{"ichi", "Ichimoku", ti_ichi_start, ti_ichi, ti_ichi_ref, TI_TYPE_INDICATOR, 2, 3, 4, {"high", "low", 0}, {"period9", "period26", "period52", 0}, {"ichi_tenkan_sen", "ichi_kijun_sen", "ichi_senkou_span_A", "ichi_senkou_span_B", 0}, ti_ichi_stream_new, ti_ichi_stream_run, ti_ichi_stream_free, 0, 0, 0, 0, ti_ichi_range, ti_ichi_stream_save, ti_ichi_stream_load, ti_ichi_stream_clone, ti_ichi_stream_clone_into, ti_ichi_stream_peek},
+{"idwma", "Inverse Distance Weighted Moving Average", ti_idwma_start, ti_idwma, ti_idwma_ref, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "exponent", 0}, {"idwma", 0}, ti_idwma_stream_new, ti_idwma_stream_run, ti_idwma_stream_free, 0, 0, 0, 0, ti_idwma_range, ti_idwma_stream_save, ti_idwma_stream_load, ti_idwma_stream_clone, ti_idwma_stream_clone_into, ti_idwma_stream_peek},
+{"kama", "Kaufman Adaptive Moving Average", ti_kama_start, ti_kama, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"kama", 0}, 0, 0, 0, 0, 0, 0, 0, ti_kama_range, 0, 0, 0, 0, 0},
+{"kc", "Keltner Channel", ti_kc_start, ti_kc, 0, TI_TYPE_OVERLAY, 3, 2, 3, {"high", "low", "close", 0}, {"period", "multiple", 0}, {"kc_lower", "kc_middle", "kc_upper", 0}, ti_kc_stream_new, ti_kc_stream_run, ti_kc_stream_free, ti_kc_batch_new, ti_kc_batch_run, ti_kc_batch_free, 0, ti_kc_range, ti_kc_stream_save, ti_kc_stream_load, ti_kc_stream_clone, ti_kc_stream_clone_into, ti_kc_stream_peek},
+{"kst", "Know Sure Thing", ti_kst_start, ti_kst, ti_kst_ref, TI_TYPE_INDICATOR, 1, 8, 2, {"series", 0}, {"roc1", "roc2", "roc3", "roc4", "ma1", "ma2", "ma3", "ma4", 0}, {"kst", "kst_signal", 0}, 0, 0, 0, 0, 0, 0, 0, ti_kst_range, 0, 0, 0, 0, 0},
+{"kvo", "Klinger Volume Oscillator", ti_kvo_start, ti_kvo, 0, TI_TYPE_INDICATOR, 4, 2, 1, {"high", "low", "close", "volume", 0}, {"short period", "long period", 0}, {"kvo", 0}, ti_kvo_stream_new, ti_kvo_stream_run, ti_kvo_stream_free, 0, 0, 0, 0, ti_kvo_range, ti_kvo_stream_save, ti_kvo_stream_load, ti_kvo_stream_clone, ti_kvo_stream_clone_into, ti_kvo_stream_peek},
+{"lag", "Lag", ti_lag_start, ti_lag, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"lag", 0}, 0, 0, 0, 0, 0, 0, 0, ti_lag_range, 0, 0, 0, 0, 0},
+{"lf", "Laguerre Filter", ti_lf_start, ti_lf, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"gamma", 0}, {"lf", 0}, ti_lf_stream_new, ti_lf_stream_run, ti_lf_stream_free, ti_lf_batch_new, ti_lf_batch_run, ti_lf_batch_free, 0, ti_lf_range, ti_lf_stream_save, ti_lf_stream_load, ti_lf_stream_clone, ti_lf_stream_clone_into, ti_lf_stream_peek},
+{"linreg", "Linear Regression", ti_linreg_start, ti_linreg, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"linreg", 0}, 0, 0, 0, 0, 0, 0, ti_linreg_multi, ti_linreg_range, 0, 0, 0, 0, 0},
+{"linregintercept", "Linear Regression Intercept", ti_linregintercept_start, ti_linregintercept, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"linregintercept", 0}, 0, 0, 0, 0, 0, 0, 0, ti_linregintercept_range, 0, 0, 0, 0, 0},
+{"linregslope", "Linear Regression Slope", ti_linregslope_start, ti_linregslope, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"linregslope", 0}, 0, 0, 0, 0, 0, 0, 0, ti_linregslope_range, 0, 0, 0, 0, 0},
+{"lma", "Leo Moving Average", ti_lma_start, ti_lma, ti_lma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"close", 0}, {"period", 0}, {"lma", 0}, ti_lma_stream_new, ti_lma_stream_run, ti_lma_stream_free, 0, 0, 0, 0, ti_lma_range, ti_lma_stream_save, ti_lma_stream_load, ti_lma_stream_clone, ti_lma_stream_clone_into, ti_lma_stream_peek},
+{"ln", "Vector Natural Log", ti_ln_start, ti_ln, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"ln", 0}, 0, 0, 0, 0, 0, 0, 0, ti_ln_range, 0, 0, 0, 0, 0},
+{"log10", "Vector Base-10 Log", ti_log10_start, ti_log10, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"log10", 0}, 0, 0, 0, 0, 0, 0, 0, ti_log10_range, 0, 0, 0, 0, 0},
+{"macd", "Moving Average Convergence/Divergence", ti_macd_start, ti_macd, 0, TI_TYPE_INDICATOR, 1, 3, 3, {"series", 0}, {"short period", "long period", "signal period", 0}, {"macd", "macd_signal", "macd_histogram", 0}, ti_macd_stream_new, ti_macd_stream_run, ti_macd_stream_free, 0, 0, 0, 0, ti_macd_range, ti_macd_stream_save, ti_macd_stream_load, ti_macd_stream_clone, ti_macd_stream_clone_into, ti_macd_stream_peek},
+{"mama", "MESA Adaptive Moving Average", ti_mama_start, ti_mama, ti_mama_ref, TI_TYPE_OVERLAY, 1, 2, 2, {"series", 0}, {"fastlimit", "slowlimit", 0}, {"mama", "fama", 0}, ti_mama_stream_new, ti_mama_stream_run, ti_mama_stream_free, 0, 0, 0, 0, ti_mama_range, ti_mama_stream_save, ti_mama_stream_load, ti_mama_stream_clone, ti_mama_stream_clone_into, ti_mama_stream_peek},
+{"marketfi", "Market Facilitation Index", ti_marketfi_start, ti_marketfi, 0, TI_TYPE_INDICATOR, 3, 0, 1, {"high", "low", "volume", 0}, {0}, {"marketfi", 0}, ti_marketfi_stream_new, ti_marketfi_stream_run, ti_marketfi_stream_free, 0, 0, 0, 0, ti_marketfi_range, ti_marketfi_stream_save, ti_marketfi_stream_load, ti_marketfi_stream_clone, ti_marketfi_stream_clone_into, ti_marketfi_stream_peek},
+{"mass", "Mass Index", ti_mass_start, ti_mass, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"high", "low", 0}, {"period", 0}, {"mass", 0}, ti_mass_stream_new, ti_mass_stream_run, ti_mass_stream_free, 0, 0, 0, 0, ti_mass_range, ti_mass_stream_save, ti_mass_stream_load, ti_mass_stream_clone, ti_mass_stream_clone_into, ti_mass_stream_peek},
+{"max", "Maximum In Period", ti_max_start, ti_max, ti_max_ref, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"max", 0}, ti_max_stream_new, ti_max_stream_run, ti_max_stream_free, 0, 0, 0, 0, ti_max_range, ti_max_stream_save, ti_max_stream_load, ti_max_stream_clone, ti_max_stream_clone_into, ti_max_stream_peek},
+{"md", "Mean Deviation Over Period", ti_md_start, ti_md, ti_md_ref, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"md", 0}, ti_md_stream_new, ti_md_stream_run, ti_md_stream_free, 0, 0, 0, 0, ti_md_range, ti_md_stream_save, ti_md_stream_load, ti_md_stream_clone, ti_md_stream_clone_into, ti_md_stream_peek},
+{"medprice", "Median Price", ti_medprice_start, ti_medprice, 0, TI_TYPE_OVERLAY, 2, 0, 1, {"high", "low", 0}, {0}, {"medprice", 0}, 0, 0, 0, 0, 0, 0, 0, ti_medprice_range, 0, 0, 0, 0, 0},
+{"mesastoch", "MESA Stochastic (by John F. Ehlers)", ti_mesastoch_start, ti_mesastoch, ti_mesastoch_ref, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"period", "max_cycle_considered", 0}, {"mesastoch", 0}, ti_mesastoch_stream_new, ti_mesastoch_stream_run, ti_mesastoch_stream_free, 0, 0, 0, 0, ti_mesastoch_range, ti_mesastoch_stream_save, ti_mesastoch_stream_load, ti_mesastoch_stream_clone, ti_mesastoch_stream_clone_into, ti_mesastoch_stream_peek},
+{"mfi", "Money Flow Index", ti_mfi_start, ti_mfi, 0, TI_TYPE_INDICATOR, 4, 1, 1, {"high", "low", "close", "volume", 0}, {"period", 0}, {"mfi", 0}, ti_mfi_stream_new, ti_mfi_stream_run, ti_mfi_stream_free, 0, 0, 0, 0, ti_mfi_range, ti_mfi_stream_save, ti_mfi_stream_load, ti_mfi_stream_clone, ti_mfi_stream_clone_into, ti_mfi_stream_peek},
+{"mgdyn", "McGinley Dynamic", ti_mgdyn_start, ti_mgdyn, ti_mgdyn_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"N", 0}, {"mgdyn", 0}, ti_mgdyn_stream_new, ti_mgdyn_stream_run, ti_mgdyn_stream_free, 0, 0, 0, 0, ti_mgdyn_range, ti_mgdyn_stream_save, ti_mgdyn_stream_load, ti_mgdyn_stream_clone, ti_mgdyn_stream_clone_into, ti_mgdyn_stream_peek},
+{"mhlma", "Middle-High-Low Moving Average", ti_mhlma_start, ti_mhlma, ti_mhlma_ref, TI_TYPE_OVERLAY, 1, 2, 2, {"series", 0}, {"period", "ma_period", 0}, {"mhlsma", "mhlema", 0}, ti_mhlma_stream_new, ti_mhlma_stream_run, ti_mhlma_stream_free, 0, 0, 0, 0, ti_mhlma_range, ti_mhlma_stream_save, ti_mhlma_stream_load, ti_mhlma_stream_clone, ti_mhlma_stream_clone_into, ti_mhlma_stream_peek},
+{"min", "Minimum In Period", ti_min_start, ti_min, ti_min_ref, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"min", 0}, ti_min_stream_new, ti_min_stream_run, ti_min_stream_free, 0, 0, 0, 0, ti_min_range, ti_min_stream_save, ti_min_stream_load, ti_min_stream_clone, ti_min_stream_clone_into, ti_min_stream_peek},
+{"mom", "Momentum", ti_mom_start, ti_mom, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"mom", 0}, 0, 0, 0, 0, 0, 0, 0, ti_mom_range, 0, 0, 0, 0, 0},
+{"msw", "Mesa Sine Wave", ti_msw_start, ti_msw, ti_msw_ref, TI_TYPE_INDICATOR, 1, 1, 2, {"series", 0}, {"period", 0}, {"msw_sine", "msw_lead", 0}, ti_msw_stream_new, ti_msw_stream_run, ti_msw_stream_free, 0, 0, 0, 0, ti_msw_range, ti_msw_stream_save, ti_msw_stream_load, ti_msw_stream_clone, ti_msw_stream_clone_into, ti_msw_stream_peek},
+{"mul", "Vector Multiplication", ti_mul_start, ti_mul, 0, TI_TYPE_SIMPLE, 2, 0, 1, {"series", "series", 0}, {0}, {"mul", 0}, 0, 0, 0, 0, 0, 0, 0, ti_mul_range, 0, 0, 0, 0, 0},
+{"natr", "Normalized Average True Range", ti_natr_start, ti_natr, 0, TI_TYPE_INDICATOR, 3, 1, 1, {"high", "low", "close", 0}, {"period", 0}, {"natr", 0}, 0, 0, 0, 0, 0, 0, 0, ti_natr_range, 0, 0, 0, 0, 0},
+{"nvi", "Negative Volume Index", ti_nvi_start, ti_nvi, 0, TI_TYPE_INDICATOR, 2, 0, 1, {"close", "volume", 0}, {0}, {"nvi", 0}, ti_nvi_stream_new, ti_nvi_stream_run, ti_nvi_stream_free, 0, 0, 0, 0, ti_nvi_range, ti_nvi_stream_save, ti_nvi_stream_load, ti_nvi_stream_clone, ti_nvi_stream_clone_into, ti_nvi_stream_peek},
+{"obv", "On Balance Volume", ti_obv_start, ti_obv, 0, TI_TYPE_INDICATOR, 2, 0, 1, {"close", "volume", 0}, {0}, {"obv", 0}, ti_obv_stream_new, ti_obv_stream_run, ti_obv_stream_free, 0, 0, 0, 0, ti_obv_range, ti_obv_stream_save, ti_obv_stream_load, ti_obv_stream_clone, ti_obv_stream_clone_into, ti_obv_stream_peek},
+{"pbands", "Projection Bands", ti_pbands_start, ti_pbands, ti_pbands_ref, TI_TYPE_OVERLAY, 3, 1, 2, {"high", "low", "close", 0}, {"period", 0}, {"pbands_lower", "pbands_upper", 0}, ti_pbands_stream_new, ti_pbands_stream_run, ti_pbands_stream_free, 0, 0, 0, 0, ti_pbands_range, ti_pbands_stream_save, ti_pbands_stream_load, ti_pbands_stream_clone, ti_pbands_stream_clone_into, ti_pbands_stream_peek},
+{"pc", "Price Channel", ti_pc_start, ti_pc, 0, TI_TYPE_OVERLAY, 2, 1, 2, {"high", "low", 0}, {"period", 0}, {"pc_low", "pc_high", 0}, ti_pc_stream_new, ti_pc_stream_run, ti_pc_stream_free, 0, 0, 0, 0, ti_pc_range, ti_pc_stream_save, ti_pc_stream_load, ti_pc_stream_clone, ti_pc_stream_clone_into, ti_pc_stream_peek},
+{"pfe", "Polarized Fractal Efficiency", ti_pfe_start, ti_pfe, ti_pfe_ref, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"period", "ema_period", 0}, {"pfe", 0}, ti_pfe_stream_new, ti_pfe_stream_run, ti_pfe_stream_free, 0, 0, 0, 0, ti_pfe_range, ti_pfe_stream_save, ti_pfe_stream_load, ti_pfe_stream_clone, ti_pfe_stream_clone_into, ti_pfe_stream_peek},
+{"posc", "Projection Oscillator", ti_posc_start, ti_posc, ti_posc_ref, TI_TYPE_INDICATOR, 3, 2, 1, {"high", "low", "close", 0}, {"period", "ema_period", 0}, {"posc", 0}, ti_posc_stream_new, ti_posc_stream_run, ti_posc_stream_free, 0, 0, 0, 0, ti_posc_range, ti_posc_stream_save, ti_posc_stream_load, ti_posc_stream_clone, ti_posc_stream_clone_into, ti_posc_stream_peek},
+{"ppo", "Percentage Price Oscillator", ti_ppo_start, ti_ppo, 0, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"short period", "long period", 0}, {"ppo", 0}, ti_ppo_stream_new, ti_ppo_stream_run, ti_ppo_stream_free, 0, 0, 0, 0, ti_ppo_range, ti_ppo_stream_save, ti_ppo_stream_load, ti_ppo_stream_clone, ti_ppo_stream_clone_into, ti_ppo_stream_peek},
+{"psar", "Parabolic SAR", ti_psar_start, ti_psar, 0, TI_TYPE_OVERLAY, 2, 2, 1, {"high", "low", 0}, {"acceleration factor step", "acceleration factor maximum", 0}, {"psar", 0}, 0, 0, 0, 0, 0, 0, 0, ti_psar_range, 0, 0, 0, 0, 0},
+{"pvi", "Positive Volume Index", ti_pvi_start, ti_pvi, 0, TI_TYPE_INDICATOR, 2, 0, 1, {"close", "volume", 0}, {0}, {"pvi", 0}, ti_pvi_stream_new, ti_pvi_stream_run, ti_pvi_stream_free, 0, 0, 0, 0, ti_pvi_range, ti_pvi_stream_save, ti_pvi_stream_load, ti_pvi_stream_clone, ti_pvi_stream_clone_into, ti_pvi_stream_peek},
+{"pvt", "Price Volume Trend", ti_pvt_start, ti_pvt, ti_pvt_ref, TI_TYPE_INDICATOR, 2, 0, 1, {"close", "volume", 0}, {0}, {"pvt", 0}, ti_pvt_stream_new, ti_pvt_stream_run, ti_pvt_stream_free, 0, 0, 0, 0, ti_pvt_range, ti_pvt_stream_save, ti_pvt_stream_load, ti_pvt_stream_clone, ti_pvt_stream_clone_into, ti_pvt_stream_peek},
+{"pwma", "Power Weighted Moving Average", ti_pwma_start, ti_pwma, ti_pwma_ref, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "power", 0}, {"pwma", 0}, ti_pwma_stream_new, ti_pwma_stream_run, ti_pwma_stream_free, 0, 0, 0, 0, ti_pwma_range, ti_pwma_stream_save, ti_pwma_stream_load, ti_pwma_stream_clone, ti_pwma_stream_clone_into, ti_pwma_stream_peek},
+{"qstick", "Qstick", ti_qstick_start, ti_qstick, 0, TI_TYPE_INDICATOR, 2, 1, 1, {"open", "close", 0}, {"period", 0}, {"qstick", 0}, 0, 0, 0, 0, 0, 0, 0, ti_qstick_range, 0, 0, 0, 0, 0},
+{"rema", "Regularized Exponential Moving Average", ti_rema_start, ti_rema, 0, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "lambda", 0}, {"rema", 0}, ti_rema_stream_new, ti_rema_stream_run, ti_rema_stream_free, 0, 0, 0, 0, ti_rema_range, ti_rema_stream_save, ti_rema_stream_load, ti_rema_stream_clone, ti_rema_stream_clone_into, ti_rema_stream_peek},
+{"rmf", "Recursive Median Filter", ti_rmf_start, ti_rmf, 0, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"critical_period", "median_period", 0}, {"rmf", 0}, ti_rmf_stream_new, ti_rmf_stream_run, ti_rmf_stream_free, 0, 0, 0, 0, ti_rmf_range, ti_rmf_stream_save, ti_rmf_stream_load, ti_rmf_stream_clone, ti_rmf_stream_clone_into, ti_rmf_stream_peek},
+{"rmi", "Relative Momentum Index", ti_rmi_start, ti_rmi, ti_rmi_ref, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"period", "lookback_period", 0}, {"rmi", 0}, ti_rmi_stream_new, ti_rmi_stream_run, ti_rmi_stream_free, 0, 0, 0, 0, ti_rmi_range, ti_rmi_stream_save, ti_rmi_stream_load, ti_rmi_stream_clone, ti_rmi_stream_clone_into, ti_rmi_stream_peek},
+{"rmta", "Recursive Moving Trend Average", ti_rmta_start, ti_rmta, 0, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "beta", 0}, {"rmta", 0}, 0, 0, 0, 0, 0, 0, 0, ti_rmta_range, 0, 0, 0, 0, 0},
+{"roc", "Rate of Change", ti_roc_start, ti_roc, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"roc", 0}, 0, 0, 0, 0, 0, 0, 0, ti_roc_range, 0, 0, 0, 0, 0},
+{"rocr", "Rate of Change Ratio", ti_rocr_start, ti_rocr, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"rocr", 0}, 0, 0, 0, 0, 0, 0, 0, ti_rocr_range, 0, 0, 0, 0, 0},
+{"roof", "The Roofing Filter", ti_roof_start, ti_roof, 0, TI_TYPE_OVERLAY, 1, 0, 1, {"series", 0}, {0}, {"roof", 0}, ti_roof_stream_new, ti_roof_stream_run, ti_roof_stream_free, 0, 0, 0, 0, ti_roof_range, ti_roof_stream_save, ti_roof_stream_load, ti_roof_stream_clone, ti_roof_stream_clone_into, ti_roof_stream_peek},
+{"round", "Vector Round", ti_round_start, ti_round, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"round", 0}, 0, 0, 0, 0, 0, 0, 0, ti_round_range, 0, 0, 0, 0, 0},
+{"rsi", "Relative Strength Index", ti_rsi_start, ti_rsi, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"rsi", 0}, ti_rsi_stream_new, ti_rsi_stream_run, ti_rsi_stream_free, 0, 0, 0, ti_rsi_multi, ti_rsi_range, ti_rsi_stream_save, ti_rsi_stream_load, ti_rsi_stream_clone, ti_rsi_stream_clone_into, ti_rsi_stream_peek},
+{"rvi", "Relative Volatility Index", ti_rvi_start, ti_rvi, 0, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"ema_period", "stddev_period", 0}, {"rvi", 0}, ti_rvi_stream_new, ti_rvi_stream_run, ti_rvi_stream_free, 0, 0, 0, 0, ti_rvi_range, ti_rvi_stream_save, ti_rvi_stream_load, ti_rvi_stream_clone, ti_rvi_stream_clone_into, ti_rvi_stream_peek},
+{"shmma", "Sharp Modified Moving Average", ti_shmma_start, ti_shmma, ti_shmma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"shmma", 0}, ti_shmma_stream_new, ti_shmma_stream_run, ti_shmma_stream_free, 0, 0, 0, 0, ti_shmma_range, ti_shmma_stream_save, ti_shmma_stream_load, ti_shmma_stream_clone, ti_shmma_stream_clone_into, ti_shmma_stream_peek},
+{"sin", "Vector Sine", ti_sin_start, ti_sin, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"sin", 0}, 0, 0, 0, 0, 0, 0, 0, ti_sin_range, 0, 0, 0, 0, 0},
+{"sinh", "Vector Hyperbolic Sine", ti_sinh_start, ti_sinh, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"sinh", 0}, 0, 0, 0, 0, 0, 0, 0, ti_sinh_range, 0, 0, 0, 0, 0},
+{"sma", "Simple Moving Average", ti_sma_start, ti_sma, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"sma", 0}, ti_sma_stream_new, ti_sma_stream_run, ti_sma_stream_free, ti_sma_batch_new, ti_sma_batch_run, ti_sma_batch_free, ti_sma_multi, ti_sma_range, ti_sma_stream_save, ti_sma_stream_load, ti_sma_stream_clone, ti_sma_stream_clone_into, ti_sma_stream_peek},
+{"smi", "Stochastic Momentum Index", ti_smi_start, ti_smi, ti_smi_ref, TI_TYPE_INDICATOR, 3, 3, 1, {"high", "low", "close", 0}, {"q_period", "r_period", "s_period", 0}, {"smi", 0}, ti_smi_stream_new, ti_smi_stream_run, ti_smi_stream_free, 0, 0, 0, 0, ti_smi_range, ti_smi_stream_save, ti_smi_stream_load, ti_smi_stream_clone, ti_smi_stream_clone_into, ti_smi_stream_peek},
+{"sqrt", "Vector Square Root", ti_sqrt_start, ti_sqrt, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"sqrt", 0}, 0, 0, 0, 0, 0, 0, 0, ti_sqrt_range, 0, 0, 0, 0, 0},
+{"ssmooth", "SuperSmoother Filter", ti_ssmooth_start, ti_ssmooth, 0, TI_TYPE_OVERLAY, 1, 0, 1, {"series", 0}, {0}, {"ssmooth", 0}, ti_ssmooth_stream_new, ti_ssmooth_stream_run, ti_ssmooth_stream_free, 0, 0, 0, 0, ti_ssmooth_range, ti_ssmooth_stream_save, ti_ssmooth_stream_load, ti_ssmooth_stream_clone, ti_ssmooth_stream_clone_into, ti_ssmooth_stream_peek},
+{"stddev", "Standard Deviation Over Period", ti_stddev_start, ti_stddev, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"stddev", 0}, ti_stddev_stream_new, ti_stddev_stream_run, ti_stddev_stream_free, 0, 0, 0, ti_stddev_multi, ti_stddev_range, ti_stddev_stream_save, ti_stddev_stream_load, ti_stddev_stream_clone, ti_stddev_stream_clone_into, ti_stddev_stream_peek},
+{"stderr", "Standard Error Over Period", ti_stderr_start, ti_stderr, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"stderr", 0}, ti_stderr_stream_new, ti_stderr_stream_run, ti_stderr_stream_free, 0, 0, 0, 0, ti_stderr_range, ti_stderr_stream_save, ti_stderr_stream_load, ti_stderr_stream_clone, ti_stderr_stream_clone_into, ti_stderr_stream_peek},
+{"stoch", "Stochastic Oscillator", ti_stoch_start, ti_stoch, 0, TI_TYPE_INDICATOR, 3, 3, 2, {"high", "low", "close", 0}, {"k period", "k slowing period", "d period", 0}, {"stoch_k", "stoch_d", 0}, ti_stoch_stream_new, ti_stoch_stream_run, ti_stoch_stream_free, 0, 0, 0, 0, ti_stoch_range, ti_stoch_stream_save, ti_stoch_stream_load, ti_stoch_stream_clone, ti_stoch_stream_clone_into, ti_stoch_stream_peek},
+{"stochrsi", "Stochastic RSI", ti_stochrsi_start, ti_stochrsi, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"stochrsi", 0}, ti_stochrsi_stream_new, ti_stochrsi_stream_run, ti_stochrsi_stream_free, 0, 0, 0, 0, ti_stochrsi_range, ti_stochrsi_stream_save, ti_stochrsi_stream_load, ti_stochrsi_stream_clone, ti_stochrsi_stream_clone_into, ti_stochrsi_stream_peek},
+{"sub", "Vector Subtraction", ti_sub_start, ti_sub, 0, TI_TYPE_SIMPLE, 2, 0, 1, {"series", "series", 0}, {0}, {"sub", 0}, 0, 0, 0, 0, 0, 0, 0, ti_sub_range, 0, 0, 0, 0, 0},
+{"sum", "Sum Over Period", ti_sum_start, ti_sum, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"sum", 0}, 0, 0, 0, 0, 0, 0, ti_sum_multi, ti_sum_range, 0, 0, 0, 0, 0},
+{"swma", "Sine Weighted Moving Average", ti_swma_start, ti_swma, ti_swma_ref, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"swma", 0}, ti_swma_stream_new, ti_swma_stream_run, ti_swma_stream_free, 0, 0, 0, 0, ti_swma_range, ti_swma_stream_save, ti_swma_stream_load, ti_swma_stream_clone, ti_swma_stream_clone_into, ti_swma_stream_peek},
+{"t3", "T3 Moving Average", ti_t3_start, ti_t3, ti_t3_ref, TI_TYPE_OVERLAY, 1, 2, 1, {"series", 0}, {"period", "v", 0}, {"t3", 0}, ti_t3_stream_new, ti_t3_stream_run, ti_t3_stream_free, 0, 0, 0, 0, ti_t3_range, ti_t3_stream_save, ti_t3_stream_load, ti_t3_stream_clone, ti_t3_stream_clone_into, ti_t3_stream_peek},
+{"tan", "Vector Tangent", ti_tan_start, ti_tan, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"tan", 0}, 0, 0, 0, 0, 0, 0, 0, ti_tan_range, 0, 0, 0, 0, 0},
+{"tanh", "Vector Hyperbolic Tangent", ti_tanh_start, ti_tanh, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"tanh", 0}, 0, 0, 0, 0, 0, 0, 0, ti_tanh_range, 0, 0, 0, 0, 0},
+{"tema", "Triple Exponential Moving Average", ti_tema_start, ti_tema, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"tema", 0}, ti_tema_stream_new, ti_tema_stream_run, ti_tema_stream_free, 0, 0, 0, 0, ti_tema_range, ti_tema_stream_save, ti_tema_stream_load, ti_tema_stream_clone, ti_tema_stream_clone_into, ti_tema_stream_peek},
+{"todeg", "Vector Degree Conversion", ti_todeg_start, ti_todeg, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"degrees", 0}, 0, 0, 0, 0, 0, 0, 0, ti_todeg_range, 0, 0, 0, 0, 0},
+{"torad", "Vector Radian Conversion", ti_torad_start, ti_torad, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"radians", 0}, 0, 0, 0, 0, 0, 0, 0, ti_torad_range, 0, 0, 0, 0, 0},
+{"tr", "True Range", ti_tr_start, ti_tr, 0, TI_TYPE_INDICATOR, 3, 0, 1, {"high", "low", "close", 0}, {0}, {"tr", 0}, 0, 0, 0, 0, 0, 0, 0, ti_tr_range, 0, 0, 0, 0, 0},
+{"trima", "Triangular Moving Average", ti_trima_start, ti_trima, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"trima", 0}, 0, 0, 0, 0, 0, 0, 0, ti_trima_range, 0, 0, 0, 0, 0},
+{"trix", "Trix", ti_trix_start, ti_trix, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"trix", 0}, ti_trix_stream_new, ti_trix_stream_run, ti_trix_stream_free, 0, 0, 0, 0, ti_trix_range, ti_trix_stream_save, ti_trix_stream_load, ti_trix_stream_clone, ti_trix_stream_clone_into, ti_trix_stream_peek},
+{"trunc", "Vector Truncate", ti_trunc_start, ti_trunc, 0, TI_TYPE_SIMPLE, 1, 0, 1, {"series", 0}, {0}, {"trunc", 0}, 0, 0, 0, 0, 0, 0, 0, ti_trunc_range, 0, 0, 0, 0, 0},
+{"tsf", "Time Series Forecast", ti_tsf_start, ti_tsf, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"tsf", 0}, 0, 0, 0, 0, 0, 0, 0, ti_tsf_range, 0, 0, 0, 0, 0},
+{"tsi", "True Strength Index", ti_tsi_start, ti_tsi, ti_tsi_ref, TI_TYPE_INDICATOR, 1, 2, 1, {"series", 0}, {"y_period", "z_period", 0}, {"tsi", 0}, ti_tsi_stream_new, ti_tsi_stream_run, ti_tsi_stream_free, 0, 0, 0, 0, ti_tsi_range, ti_tsi_stream_save, ti_tsi_stream_load, ti_tsi_stream_clone, ti_tsi_stream_clone_into, ti_tsi_stream_peek},
+{"typprice", "Typical Price", ti_typprice_start, ti_typprice, 0, TI_TYPE_OVERLAY, 3, 0, 1, {"high", "low", "close", 0}, {0}, {"typprice", 0}, 0, 0, 0, 0, 0, 0, 0, ti_typprice_range, 0, 0, 0, 0, 0},
+{"ultosc", "Ultimate Oscillator", ti_ultosc_start, ti_ultosc, 0, TI_TYPE_INDICATOR, 3, 3, 1, {"high", "low", "close", 0}, {"short period", "medium period", "long period", 0}, {"ultosc", 0}, ti_ultosc_stream_new, ti_ultosc_stream_run, ti_ultosc_stream_free, 0, 0, 0, 0, ti_ultosc_range, ti_ultosc_stream_save, ti_ultosc_stream_load, ti_ultosc_stream_clone, ti_ultosc_stream_clone_into, ti_ultosc_stream_peek},
+{"var", "Variance Over Period", ti_var_start, ti_var, 0, TI_TYPE_MATH, 1, 1, 1, {"series", 0}, {"period", 0}, {"var", 0}, ti_var_stream_new, ti_var_stream_run, ti_var_stream_free, 0, 0, 0, ti_var_multi, ti_var_range, ti_var_stream_save, ti_var_stream_load, ti_var_stream_clone, ti_var_stream_clone_into, ti_var_stream_peek},
+{"vhf", "Vertical Horizontal Filter", ti_vhf_start, ti_vhf, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"vhf", 0}, 0, 0, 0, 0, 0, 0, 0, ti_vhf_range, 0, 0, 0, 0, 0},
+{"vi", "Vortex Indicator", ti_vi_start, ti_vi, ti_vi_ref, TI_TYPE_INDICATOR, 3, 1, 2, {"high", "low", "close", 0}, {"period", 0}, {"vi_p", "vi_m", 0}, ti_vi_stream_new, ti_vi_stream_run, ti_vi_stream_free, 0, 0, 0, 0, ti_vi_range, ti_vi_stream_save, ti_vi_stream_load, ti_vi_stream_clone, ti_vi_stream_clone_into, ti_vi_stream_peek},
+{"vidya", "Variable Index Dynamic Average", ti_vidya_start, ti_vidya, 0, TI_TYPE_OVERLAY, 1, 3, 1, {"series", 0}, {"short period", "long period", "alpha", 0}, {"vidya", 0}, 0, 0, 0, 0, 0, 0, 0, ti_vidya_range, 0, 0, 0, 0, 0},
+{"volatility", "Annualized Historical Volatility", ti_volatility_start, ti_volatility, 0, TI_TYPE_INDICATOR, 1, 1, 1, {"series", 0}, {"period", 0}, {"volatility", 0}, ti_volatility_stream_new, ti_volatility_stream_run, ti_volatility_stream_free, 0, 0, 0, 0, ti_volatility_range, ti_volatility_stream_save, ti_volatility_stream_load, ti_volatility_stream_clone, ti_volatility_stream_clone_into, ti_volatility_stream_peek},
+{"vosc", "Volume Oscillator", ti_vosc_start, ti_vosc, 0, TI_TYPE_INDICATOR, 1, 2, 1, {"volume", 0}, {"short period", "long period", 0}, {"vosc", 0}, ti_vosc_stream_new, ti_vosc_stream_run, ti_vosc_stream_free, 0, 0, 0, 0, ti_vosc_range, ti_vosc_stream_save, ti_vosc_stream_load, ti_vosc_stream_clone, ti_vosc_stream_clone_into, ti_vosc_stream_peek},
+{"vwap", "Volume Weighted Average Price", ti_vwap_start, ti_vwap, ti_vwap_ref, TI_TYPE_OVERLAY, 4, 1, 1, {"high", "low", "close", "volume", 0}, {"period", 0}, {"vwap", 0}, ti_vwap_stream_new, ti_vwap_stream_run, ti_vwap_stream_free, 0, 0, 0, 0, ti_vwap_range, ti_vwap_stream_save, ti_vwap_stream_load, ti_vwap_stream_clone, ti_vwap_stream_clone_into, ti_vwap_stream_peek},
+{"vwma", "Volume Weighted Moving Average", ti_vwma_start, ti_vwma, 0, TI_TYPE_OVERLAY, 2, 1, 1, {"close", "volume", 0}, {"period", 0}, {"vwma", 0}, ti_vwma_stream_new, ti_vwma_stream_run, ti_vwma_stream_free, 0, 0, 0, 0, ti_vwma_range, ti_vwma_stream_save, ti_vwma_stream_load, ti_vwma_stream_clone, ti_vwma_stream_clone_into, ti_vwma_stream_peek},
+{"wad", "Williams Accumulation/Distribution", ti_wad_start, ti_wad, 0, TI_TYPE_INDICATOR, 3, 0, 1, {"high", "low", "close", 0}, {0}, {"wad", 0}, 0, 0, 0, 0, 0, 0, 0, ti_wad_range, 0, 0, 0, 0, 0},
+{"wcprice", "Weighted Close Price", ti_wcprice_start, ti_wcprice, 0, TI_TYPE_OVERLAY, 3, 0, 1, {"high", "low", "close", 0}, {0}, {"wcprice", 0}, 0, 0, 0, 0, 0, 0, 0, ti_wcprice_range, 0, 0, 0, 0, 0},
+{"wilders", "Wilders Smoothing", ti_wilders_start, ti_wilders, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"wilders", 0}, ti_wilders_stream_new, ti_wilders_stream_run, ti_wilders_stream_free, 0, 0, 0, 0, ti_wilders_range, ti_wilders_stream_save, ti_wilders_stream_load, ti_wilders_stream_clone, ti_wilders_stream_clone_into, ti_wilders_stream_peek},
+{"willr", "Williams %R", ti_willr_start, ti_willr, 0, TI_TYPE_INDICATOR, 3, 1, 1, {"high", "low", "close", 0}, {"period", 0}, {"willr", 0}, ti_willr_stream_new, ti_willr_stream_run, ti_willr_stream_free, 0, 0, 0, 0, ti_willr_range, ti_willr_stream_save, ti_willr_stream_load, ti_willr_stream_clone, ti_willr_stream_clone_into, ti_willr_stream_peek},
+{"wma", "Weighted Moving Average", ti_wma_start, ti_wma, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"wma", 0}, 0, 0, 0, 0, 0, 0, ti_wma_multi, ti_wma_range, 0, 0, 0, 0, 0},
+{"zlema", "Zero-Lag Exponential Moving Average", ti_zlema_start, ti_zlema, 0, TI_TYPE_OVERLAY, 1, 1, 1, {"series", 0}, {"period", 0}, {"zlema", 0}, ti_zlema_stream_new, ti_zlema_stream_run, ti_zlema_stream_free, 0, 0, 0, 0, ti_zlema_range, ti_zlema_stream_save, ti_zlema_stream_load, ti_zlema_stream_clone, ti_zlema_stream_clone_into, ti_zlema_stream_peek},
+{0,0,0,0,0,0,0,0,0,{0,0},{0,0},{0,0},0,0,0,0,0,0,0,0,0,0,0,0,0}
+};
+int ti_stream_run(ti_stream *stream, int size, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_indicators[stream->index].stream_run(stream, size, inputs, outputs);
+}
+
+ti_indicator_info *ti_stream_get_info(ti_stream *stream) {
+    return ti_indicators + stream->index;
+}
+
+int ti_stream_get_progress(ti_stream *stream) {
+    return stream->progress;
+}
+
+void ti_stream_free(ti_stream *stream) {
+    ti_indicators[stream->index].stream_free(stream);
+}
+
+int ti_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_indicators[stream->index].stream_peek(stream, inputs, outputs);
+}
+
+enum { ti_stream_header_size = 48, ti_stream_name_size = 32 };
+static const char ti_stream_magic[4] = {'t', 'i', 's', 't'};
+
+static size_t ti_stream_padded(size_t payload) {
+    return (payload + 7) / 8 * 8;
+}
+
+size_t ti_stream_serialized_size(ti_stream *stream) {
+    return ti_stream_header_size + ti_stream_padded(ti_indicators[stream->index].stream_save(stream, 0));
+}
+
+int ti_stream_save(ti_stream *stream, void *buf) {
+    const ti_indicator_info *info = ti_indicators + stream->index;
+    char *header = (char*)buf;
+    const unsigned int version = TI_STREAM_FORMAT_VERSION;
+    const unsigned long long payload = info->stream_save(stream, header + ti_stream_header_size);
+
+    memcpy(header, ti_stream_magic, 4);
+    memcpy(header + 4, &version, 4);
+    memset(header + 8, 0, ti_stream_name_size);
+    strncpy(header + 8, info->name, ti_stream_name_size - 1);
+    memcpy(header + 8 + ti_stream_name_size, &payload, 8);
+    memset(header + ti_stream_header_size + payload, 0, ti_stream_padded(payload) - payload);
+    return TI_OKAY;
+}
+
+int ti_stream_load(void const *buf, ti_stream **stream) {
+    const char *header = (const char*)buf;
+    unsigned int version;
+    unsigned long long payload;
+    char name[ti_stream_name_size];
+
+    if (memcmp(header, ti_stream_magic, 4) != 0) { return TI_INVALID_OPTION; }
+    memcpy(&version, header + 4, 4);
+    if (version != TI_STREAM_FORMAT_VERSION) { return TI_INVALID_OPTION; }
+    memcpy(name, header + 8, ti_stream_name_size);
+    if (name[ti_stream_name_size - 1] != 0) { return TI_INVALID_OPTION; }
+    memcpy(&payload, header + 8 + ti_stream_name_size, 8);
+
+    const ti_indicator_info *info = ti_find_indicator(name);
+    if (!info || !info->stream_load) { return TI_INVALID_OPTION; }
+    return info->stream_load(header + ti_stream_header_size, (size_t)payload, stream);
+}
+
+int ti_stream_clone(ti_stream const *stream, ti_stream **clone) {
+    return ti_indicators[stream->index].stream_clone(stream, clone);
+}
+
+int ti_stream_clone_into(ti_stream const *stream, ti_stream *clone) {
+    if (clone->index != stream->index) { return TI_INVALID_OPTION; }
+    return ti_indicators[stream->index].stream_clone_into(stream, clone);
+}
+
+/* The fallback for streams without a hand-tuned peek, see utils/peek.cc */
+int ti_stream_peek_generic(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs);
+
+int ti_ad_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_adosc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_adx_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_adxr_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_ahma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_aroon_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_aroonosc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_arsi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_bbands_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_bf2_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_bf3_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_cci_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_cmf_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_cmi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_copp_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_cvi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_di_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_dm_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_dwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_dx_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_edcf_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_ehma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_emsd_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_emv_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_er_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_evwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_fisher_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_frama_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_gf1_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_gf2_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_gf3_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_gf4_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hd_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hf_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hfema_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hfsma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hurst_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_hwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_ichi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_idwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_kvo_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_lf_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_lma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mama_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_marketfi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mass_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_max_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_md_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mesastoch_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mfi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mgdyn_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_mhlma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_min_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_msw_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_nvi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_obv_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pbands_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pfe_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_posc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pvi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pvt_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_pwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_rema_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_rmf_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_rmi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_roof_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_rvi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_shmma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_smi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_ssmooth_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_stddev_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_stderr_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_stoch_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_stochrsi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_swma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_t3_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_trix_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_tsi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_ultosc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_var_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_vi_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_volatility_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_vosc_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_vwap_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_vwma_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_willr_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+int ti_zlema_stream_peek(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_stream_peek_generic(stream, inputs, outputs);
+}
+
+int ti_batch_run(ti_batch *batch, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    return ti_indicators[batch->index].batch_run(batch, inputs, outputs);
+}
+
+ti_indicator_info *ti_batch_get_info(ti_batch *batch) {
+    return ti_indicators + batch->index;
+}
+
+int ti_batch_get_progress(ti_batch *batch) {
+    return batch->progress;
+}
+
+int ti_batch_get_nsymbols(ti_batch *batch) {
+    return batch->nsymbols;
+}
+
+void ti_batch_free(ti_batch *batch) {
+    ti_indicators[batch->index].batch_free(batch);
+}
+
+/* The fallback for indicators without a hand-tuned range: the outputs depend on the past only, */
+/* so the input is cut right after the last requested output and the head of the output is dropped. */
+static int ti_range_generic(int index, int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    const ti_indicator_info *info = ti_indicators + index;
+    if (first_output < 0 || count < 0) { return TI_INVALID_OPTION; }
+    const int start = info->start(options);
+    if (start + first_output + count > size) { return TI_INVALID_OPTION; }
+    if (first_output == 0) { return info->indicator(start + count, inputs, options, outputs); }
+
+    const int outsize = first_output + count;
+    TI_REAL *scratch = (TI_REAL*)malloc(sizeof(TI_REAL) * outsize * info->outputs);
+    if (!scratch) { return TI_OUT_OF_MEMORY; }
+    TI_REAL *full_outputs[TI_MAXINDPARAMS];
+    int j;
+    for (j = 0; j < info->outputs; ++j) { full_outputs[j] = scratch + (size_t)j * outsize; }
+
+    const int ret = info->indicator(start + outsize, inputs, options, full_outputs);
+    if (ret == TI_OKAY) {
+        for (j = 0; j < info->outputs; ++j) { memcpy(outputs[j], full_outputs[j] + first_output, sizeof(TI_REAL) * count); }
+    }
+    free(scratch);
+    return ret;
+}
+
+int ti_abands_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ABANDS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_abs_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ABS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_acos_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ACOS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ad_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_add_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ADD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_adosc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ADOSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_adx_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ADX_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_adxr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ADXR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ahma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AHMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ao_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_apo_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_APO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_aroon_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AROON_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_aroonosc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AROONOSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_arsi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ARSI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_asin_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ASIN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_atan_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ATAN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_avgprice_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_AVGPRICE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_bbands_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_BBANDS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_bf2_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_BF2_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_bf3_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_BF3_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_bop_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_BOP_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cci_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CCI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ce_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ceil_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CEIL_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cmf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CMF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cmi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CMI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cmo_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CMO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_copp_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_COPP_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cos_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_COS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cosh_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_COSH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_crossany_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CROSSANY_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_crossover_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CROSSOVER_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_cvi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_CVI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_decay_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DECAY_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_dema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DEMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_di_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_div_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DIV_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_dm_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DM_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_dpo_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DPO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_dwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_dx_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_DX_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_edcf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EDCF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_edecay_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EDECAY_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ehma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EHMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_emsd_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EMSD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_emv_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EMV_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_er_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ER_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_evwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EVWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_exp_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_EXP_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_fi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_FI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_fisher_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_FISHER_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_floor_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_FLOOR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_fosc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_FOSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_frama_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_FRAMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_gf1_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_GF1_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_gf2_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_GF2_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_gf3_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_GF3_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_gf4_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_GF4_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hd_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hfema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HFEMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hfsma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HFSMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hurst_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HURST_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_hwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_HWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ichi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ICHI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_idwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_IDWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_kama_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_KAMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_kc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_KC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_kst_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_KST_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_kvo_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_KVO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_lag_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LAG_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_lf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_linregintercept_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LINREGINTERCEPT_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_linregslope_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LINREGSLOPE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_lma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ln_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_log10_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_LOG10_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_macd_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MACD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mama_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MAMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_marketfi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MARKETFI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mass_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MASS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_md_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_medprice_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MEDPRICE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mesastoch_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MESASTOCH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mfi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MFI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mgdyn_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MGDYN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mhlma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MHLMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mom_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MOM_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_msw_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MSW_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_mul_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_MUL_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_natr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_NATR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_nvi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_NVI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_obv_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_OBV_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pbands_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PBANDS_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pfe_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PFE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_posc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_POSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ppo_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PPO_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_psar_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PSAR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pvi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PVI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pvt_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PVT_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_pwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_PWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_qstick_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_QSTICK_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_REMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rmf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_RMF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rmi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_RMI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rmta_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_RMTA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_roc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ROC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rocr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ROCR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_roof_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ROOF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_round_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ROUND_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_rvi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_RVI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_shmma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SHMMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_sin_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SIN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_sinh_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SINH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_smi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SMI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_sqrt_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SQRT_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ssmooth_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SSMOOTH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_stderr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_STDERR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_stoch_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_STOCH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_stochrsi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_STOCHRSI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_sub_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SUB_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_swma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_SWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_t3_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_T3_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tan_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TAN_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tanh_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TANH_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TEMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_todeg_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TODEG_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_torad_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TORAD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tr_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TR_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_trima_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TRIMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_trix_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TRIX_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_trunc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TRUNC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tsf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TSF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_tsi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TSI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_typprice_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_TYPPRICE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_ultosc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ULTOSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vhf_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VHF_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vi_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VI_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vidya_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VIDYA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_volatility_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VOLATILITY_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vosc_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VOSC_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vwap_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VWAP_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_vwma_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_VWMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_wad_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_WAD_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_wcprice_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_WCPRICE_INDEX, size, inputs, options, first_output, count, outputs);
+}
+int ti_zlema_range(int size, TI_REAL const *const *inputs, TI_REAL const *options, int first_output, int count, TI_REAL *const *outputs) {
+    return ti_range_generic(TI_INDICATOR_ZLEMA_INDEX, size, inputs, options, first_output, count, outputs);
+}
+
+const ti_indicator_info *ti_find_indicator(const char *name) {
+    int imin = 0;
+    int imax = sizeof(ti_indicators) / sizeof(ti_indicator_info) - 2;
+
+    /* Binary search */
+    while (imax >= imin) {
+        const int i = (imin + ((imax-imin)/2));
+        const int c = strcmp(name, ti_indicators[i].name);
+        if (c == 0) {
+            return ti_indicators + i;
+        } else if (c > 0) {
+            imin = i + 1;
+        } else {
+            imax = i - 1;
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
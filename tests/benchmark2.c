@@ -20,6 +20,7 @@
 #define MIN_PERIOD 4
 #define MAX_PERIOD 150
 #define LOOPS 10
+#define NSYMBOLS 3
 
 TI_REAL g_inputs[TI_MAXINDPARAMS][INSIZE];
 
@@ -208,7 +209,7 @@ void hfsma_option_setter(double period, double* options) {
 }
 
 void edcf_option_setter(double period, double* options) {
-    options[0] = (1 + (int)period % 5); // known to be slow for its algorithmic complexity
+    options[0] = 1 + (int)period / 4; // the reference is quadratic in length
 }
 
 void mesastoch_option_setter(double period, double* options) {
@@ -249,8 +250,9 @@ void evwma_option_setter(double period, double* options) {
 }
 
 void pwma_option_setter(double period, double* options) {
-    options[0] = fmin(period, 10);
-    options[1] = 2;
+    const double powers[] = {2, 3, 1.5}; // the long periods of integer powers slide
+    options[0] = fmin(period, 80);
+    options[1] = powers[(int)period % 3];
 }
 
 void swma_option_setter(double period, double* options) {
@@ -283,7 +285,7 @@ void t3_option_setter(double period, double* options) {
 }
 
 void idwma_option_setter(double period, double* options) {
-    options[0] = MIN(period, 40);
+    options[0] = period <= 110 ? MIN(period, 40) : period + 50; // 161..200 convolve by fft
     options[1] = 2;
 }
 
@@ -308,63 +310,63 @@ void rmf_option_setter(double period, double* options) {
     options[1] = 5;
 }
 
-void bench(const ti_indicator_info *info) {
-    printf("Running: %s ", info->name);
-    fflush(stdout);
-
-    void (*options_setter)(double period, double *options) = simple_option_setter;
-    if (strcmp(info->name, "apo") == 0) { options_setter = ppo_option_setter; }
-    if (strcmp(info->name, "ce") == 0) { options_setter = ce_option_setter; }
-    if (strcmp(info->name, "frama") == 0) { options_setter = frama_option_setter; }
-    if (strcmp(info->name, "macd") == 0) { options_setter = macd_option_setter; }
-    if (strcmp(info->name, "ppo") == 0) { options_setter = ppo_option_setter; }
-    if (strcmp(info->name, "psar") == 0) { options_setter = psar_option_setter; }
-    if (strcmp(info->name, "adosc") == 0) { options_setter = fast_slow_option_setter; }
-    if (strcmp(info->name, "kst") == 0) { options_setter = kst_option_setter; }
-    if (strcmp(info->name, "kvo") == 0) { options_setter = fast_slow_option_setter; }
-    if (strcmp(info->name, "rmta") == 0) { options_setter = rmta_option_setter; }
-    if (strcmp(info->name, "rmi") == 0) { options_setter = rmi_option_setter; }
-    if (strcmp(info->name, "rvi") == 0) { options_setter = rvi_option_setter; }
-    if (strcmp(info->name, "tsi") == 0) { options_setter = tsi_option_setter; }
-    if (strcmp(info->name, "smi") == 0) { options_setter = smi_option_setter; }
-    if (strcmp(info->name, "stoch") == 0) { options_setter = stoch_option_setter; }
-    if (strcmp(info->name, "stochrsi") == 0) { options_setter = stochrsi_option_setter; }
-    if (strcmp(info->name, "ultosc") == 0) { options_setter = ultosc_option_setter; }
-    if (strcmp(info->name, "vosc") == 0) { options_setter = fast_slow_option_setter; }
-    if (strcmp(info->name, "vidya") == 0) { options_setter = vidya_option_setter; }
-    if (strcmp(info->name, "pfe") == 0) { options_setter = pfe_option_setter; }
-    if (strcmp(info->name, "mama") == 0) { options_setter = mama_option_setter; }
-    if (strcmp(info->name, "kc") == 0) { options_setter = kc_option_setter; }
-    if (strcmp(info->name, "copp") == 0) { options_setter = copp_option_setter; }
-    if (strcmp(info->name, "posc") == 0) { options_setter = posc_option_setter; }
-    if (strcmp(info->name, "hfsma") == 0) { options_setter = hfsma_option_setter; }
-    if (strcmp(info->name, "hfema") == 0) { options_setter = hfema_option_setter; }
-    if (strcmp(info->name, "rema") == 0) { options_setter = rema_option_setter; }
-    if (strcmp(info->name, "lf") == 0) { options_setter = lf_option_setter; }
-    if (strcmp(info->name, "edcf") == 0) { options_setter = edcf_option_setter; }
-    if (strcmp(info->name, "mesastoch") == 0) { options_setter = mesastoch_option_setter; }
-    if (strcmp(info->name, "bf2") == 0) { options_setter = bf23_option_setter; }
-    if (strcmp(info->name, "bf3") == 0) { options_setter = bf23_option_setter; }
-    if (strcmp(info->name, "gf1") == 0) { options_setter = gf1_option_setter; }
-    if (strcmp(info->name, "gf2") == 0) { options_setter = gf2_option_setter; }
-    if (strcmp(info->name, "gf3") == 0) { options_setter = gf3_option_setter; }
-    if (strcmp(info->name, "gf4") == 0) { options_setter = gf4_option_setter; }
-    if (strcmp(info->name, "ehma") == 0) { options_setter = ehma_option_setter; }
-    if (strcmp(info->name, "evwma") == 0) { options_setter = evwma_option_setter; }
-    if (strcmp(info->name, "pwma") == 0) { options_setter = pwma_option_setter; }
-    if (strcmp(info->name, "swma") == 0) { options_setter = swma_option_setter; }
-    if (strcmp(info->name, "hurst") == 0) { options_setter = hurst_option_setter; }
-    if (strcmp(info->name, "arsi") == 0) { options_setter = arsi_option_setter; }
-    if (strcmp(info->name, "mhlma") == 0) { options_setter = mhlma_option_setter; }
-    if (strcmp(info->name, "t3") == 0) { options_setter = t3_option_setter; }
-    if (strcmp(info->name, "idwma") == 0) { options_setter = idwma_option_setter; }
-    if (strcmp(info->name, "hf") == 0) { options_setter = hf_option_setter; }
-    if (strcmp(info->name, "emsd") == 0) { options_setter = emsd_option_setter; }
-    if (strcmp(info->name, "hwma") == 0) { options_setter = hwma_option_setter; }
-    if (strcmp(info->name, "ichi") == 0) { options_setter = ichi_option_setter; }
-    if (strcmp(info->name, "rmf") == 0) { options_setter = rmf_option_setter; }
-
-    static TI_REAL *inputs[TI_MAXINDPARAMS];
+typedef void (*option_setter_t)(double period, double *options);
+
+option_setter_t find_option_setter(const ti_indicator_info *info) {
+    if (strcmp(info->name, "apo") == 0) { return ppo_option_setter; }
+    if (strcmp(info->name, "ce") == 0) { return ce_option_setter; }
+    if (strcmp(info->name, "frama") == 0) { return frama_option_setter; }
+    if (strcmp(info->name, "macd") == 0) { return macd_option_setter; }
+    if (strcmp(info->name, "ppo") == 0) { return ppo_option_setter; }
+    if (strcmp(info->name, "psar") == 0) { return psar_option_setter; }
+    if (strcmp(info->name, "adosc") == 0) { return fast_slow_option_setter; }
+    if (strcmp(info->name, "kst") == 0) { return kst_option_setter; }
+    if (strcmp(info->name, "kvo") == 0) { return fast_slow_option_setter; }
+    if (strcmp(info->name, "rmta") == 0) { return rmta_option_setter; }
+    if (strcmp(info->name, "rmi") == 0) { return rmi_option_setter; }
+    if (strcmp(info->name, "rvi") == 0) { return rvi_option_setter; }
+    if (strcmp(info->name, "tsi") == 0) { return tsi_option_setter; }
+    if (strcmp(info->name, "smi") == 0) { return smi_option_setter; }
+    if (strcmp(info->name, "stoch") == 0) { return stoch_option_setter; }
+    if (strcmp(info->name, "stochrsi") == 0) { return stochrsi_option_setter; }
+    if (strcmp(info->name, "ultosc") == 0) { return ultosc_option_setter; }
+    if (strcmp(info->name, "vosc") == 0) { return fast_slow_option_setter; }
+    if (strcmp(info->name, "vidya") == 0) { return vidya_option_setter; }
+    if (strcmp(info->name, "pfe") == 0) { return pfe_option_setter; }
+    if (strcmp(info->name, "mama") == 0) { return mama_option_setter; }
+    if (strcmp(info->name, "kc") == 0) { return kc_option_setter; }
+    if (strcmp(info->name, "copp") == 0) { return copp_option_setter; }
+    if (strcmp(info->name, "posc") == 0) { return posc_option_setter; }
+    if (strcmp(info->name, "hfsma") == 0) { return hfsma_option_setter; }
+    if (strcmp(info->name, "hfema") == 0) { return hfema_option_setter; }
+    if (strcmp(info->name, "rema") == 0) { return rema_option_setter; }
+    if (strcmp(info->name, "lf") == 0) { return lf_option_setter; }
+    if (strcmp(info->name, "edcf") == 0) { return edcf_option_setter; }
+    if (strcmp(info->name, "mesastoch") == 0) { return mesastoch_option_setter; }
+    if (strcmp(info->name, "bf2") == 0) { return bf23_option_setter; }
+    if (strcmp(info->name, "bf3") == 0) { return bf23_option_setter; }
+    if (strcmp(info->name, "gf1") == 0) { return gf1_option_setter; }
+    if (strcmp(info->name, "gf2") == 0) { return gf2_option_setter; }
+    if (strcmp(info->name, "gf3") == 0) { return gf3_option_setter; }
+    if (strcmp(info->name, "gf4") == 0) { return gf4_option_setter; }
+    if (strcmp(info->name, "ehma") == 0) { return ehma_option_setter; }
+    if (strcmp(info->name, "evwma") == 0) { return evwma_option_setter; }
+    if (strcmp(info->name, "pwma") == 0) { return pwma_option_setter; }
+    if (strcmp(info->name, "swma") == 0) { return swma_option_setter; }
+    if (strcmp(info->name, "hurst") == 0) { return hurst_option_setter; }
+    if (strcmp(info->name, "arsi") == 0) { return arsi_option_setter; }
+    if (strcmp(info->name, "mhlma") == 0) { return mhlma_option_setter; }
+    if (strcmp(info->name, "t3") == 0) { return t3_option_setter; }
+    if (strcmp(info->name, "idwma") == 0) { return idwma_option_setter; }
+    if (strcmp(info->name, "hf") == 0) { return hf_option_setter; }
+    if (strcmp(info->name, "emsd") == 0) { return emsd_option_setter; }
+    if (strcmp(info->name, "hwma") == 0) { return hwma_option_setter; }
+    if (strcmp(info->name, "ichi") == 0) { return ichi_option_setter; }
+    if (strcmp(info->name, "rmf") == 0) { return rmf_option_setter; }
+    return simple_option_setter;
+}
+
+void find_inputs(const ti_indicator_info *info, TI_REAL **inputs) {
     for (int i = 0; i < info->inputs; ++i) {
         if (strcmp(info->input_names[i], "open") == 0) { inputs[i] = open; }
         else if (strcmp(info->input_names[i], "high") == 0) { inputs[i] = high; }
@@ -374,31 +376,47 @@ void bench(const ti_indicator_info *info) {
         else if (strcmp(info->input_names[i], "volume") == 0) { inputs[i] = volume; }
         else { assert(0 && "unsupported input"); };
     }
+}
+
+void bench(const ti_indicator_info *info) {
+    printf("Running: %s ", info->name);
+    fflush(stdout);
+
+    option_setter_t options_setter = find_option_setter(info);
+
+    static TI_REAL *inputs[TI_MAXINDPARAMS];
+    find_inputs(info, inputs);
 
     int elapsed_plain = 0;
     int elapsed_ref = 0;
     int elapsed_stream_1 = 0;
     int elapsed_stream_all = 0;
+    int elapsed_batch = 0;
+    int elapsed_multi = 0;
+    int elapsed_plan = 0;
+    int elapsed_range = 0;
 
 
     for (int i = 0; i < LOOPS; ++i) {
         for (int period = MIN_PERIOD; period <= MAX_PERIOD; ++period) {
-            static TI_REAL outputs_mem[4][TI_MAXINDPARAMS][INSIZE];
+            static TI_REAL outputs_mem[5][TI_MAXINDPARAMS][INSIZE];
             static TI_REAL options[TI_MAXINDPARAMS];
 
             static TI_REAL *outputs[TI_MAXINDPARAMS];
             static TI_REAL *outputs_ref[TI_MAXINDPARAMS];
             static TI_REAL *outputs_stream_all[TI_MAXINDPARAMS];
             static TI_REAL *outputs_stream_1[TI_MAXINDPARAMS];
+            static TI_REAL *outputs_range[TI_MAXINDPARAMS];
             for (int j = 0; j < info->outputs; ++j) {
                 outputs[j] = outputs_mem[0][j];
                 outputs_ref[j] = outputs_mem[1][j];
                 outputs_stream_all[j] = outputs_mem[2][j];
                 outputs_stream_1[j] = outputs_mem[3][j];
+                outputs_range[j] = outputs_mem[4][j];
             }
             options_setter(period, options);
 
-            const int OUTSIZE = INSIZE - info->start(options);
+            const int OUTSIZE = MAX(0, INSIZE - info->start(options));
 
             clock_t start_ts, end_ts;
 
@@ -413,6 +431,33 @@ void bench(const ti_indicator_info *info) {
                 }
             }
 
+            for (int slice = 0; slice < 2 && OUTSIZE > 0 && info->type != TI_TYPE_SIMPLE; ++slice) {
+                /* a slice from the middle, then the last output alone */
+                const int first_output = slice == 0 ? OUTSIZE / 3 : OUTSIZE - 1;
+                const int count = slice == 0 ? OUTSIZE / 3 : 1;
+                TI_REAL *outputs_slice[TI_MAXINDPARAMS] = {0};
+                for (int j = 0; j < info->outputs; ++j) { outputs_slice[j] = outputs[j] + first_output; }
+
+                start_ts = clock();
+                const int ret = info->indicator_range(INSIZE, (const TI_REAL * const*)inputs, options, first_output, count, outputs_range);
+                end_ts = clock();
+                elapsed_range += end_ts - start_ts;
+                if (ret != TI_OKAY) {
+                    printf("%s_range returned %i, exiting\n", info->name, ret);
+                    exit(2);
+                }
+                int ok = !compare_answers(info, outputs_slice, outputs_range, count, count);
+                if (!ok) {
+                    printf("%s_range mismatched at first_output=%i, exiting\n", info->name, first_output);
+                    printf("options were: ");
+                    for (int k = 0; k < info->options; ++k) {
+                        printf("%s=%f ", info->option_names[k], options[k]);
+                    }
+                    printf("\n");
+                    exit(1);
+                }
+            }
+
             if (info->indicator_ref) {
                 start_ts = clock();
                 const int ret = info->indicator_ref(INSIZE, (const TI_REAL * const*)inputs, options, outputs_ref);
@@ -495,6 +540,246 @@ void bench(const ti_indicator_info *info) {
                 }
                 ti_stream_free(stream);
             }
+
+            if (info->stream_new) {
+                /* every bar is peeked at first, then committed */
+                ti_stream *stream;
+                int ret = info->stream_new(options, &stream);
+                TI_REAL const *inputs_[TI_MAXINDPARAMS] = {0};
+                TI_REAL *outputs_[TI_MAXINDPARAMS] = {0};
+                TI_REAL peek_mem[TI_MAXINDPARAMS];
+                TI_REAL *outputs_peek[TI_MAXINDPARAMS] = {0};
+                for (int j = 0; j < info->outputs; ++j) { outputs_peek[j] = peek_mem + j; }
+                for (int bar = 0; bar < INSIZE && ret == TI_OKAY; ++bar) {
+                    for (int j = 0; j < info->inputs; ++j) { inputs_[j] = inputs[j] + bar; }
+                    const int progress = ti_stream_get_progress(stream);
+                    for (int j = 0; j < info->outputs; ++j) { outputs_[j] = outputs_stream_all[j] + MAX(0, progress); }
+                    ret = ti_stream_peek(stream, inputs_, outputs_peek);
+                    if (ret == TI_OKAY) { ret = ti_stream_run(stream, 1, inputs_, outputs_); }
+                    if (ret == TI_OKAY && progress >= 0 && compare_answers(info, outputs_, outputs_peek, 1, 1)) {
+                        printf("%s_stream_peek mismatched at bar %i, exiting\n", info->name, bar);
+                        exit(1);
+                    }
+                }
+                ti_stream_free(stream);
+                if (ret != TI_OKAY) {
+                    printf("%s_stream_peek returned %i, exiting\n", info->name, ret);
+                    exit(2);
+                }
+            }
+
+            if (info->stream_new) {
+                /* save in the middle of the input, go on with a clone of the loaded copy */
+                const int HALF = INSIZE / 2;
+                ti_stream *stream;
+                int ret = info->stream_new(options, &stream);
+                ti_stream_run(stream, HALF, (const TI_REAL * const*)inputs, outputs_stream_all);
+
+                void *buf = malloc(ti_stream_serialized_size(stream));
+                ti_stream_save(stream, buf);
+                ti_stream_free(stream);
+                ret = ti_stream_load(buf, &stream);
+                free(buf);
+                if (ret != TI_OKAY || ti_stream_get_info(stream) != info) {
+                    printf("%s_stream_load returned %i, exiting\n", info->name, ret);
+                    exit(2);
+                }
+
+                ti_stream *clone, *clone_into;
+                ret = ti_stream_clone(stream, &clone);
+                ti_stream_free(stream);
+                if (ret == TI_OKAY) { ret = info->stream_new(options, &clone_into); }
+                if (ret == TI_OKAY) { ret = ti_stream_clone_into(clone, clone_into); }
+                if (ret != TI_OKAY) {
+                    printf("%s_stream_clone returned %i, exiting\n", info->name, ret);
+                    exit(2);
+                }
+                ti_stream_free(clone);
+                stream = clone_into;
+
+                TI_REAL const *inputs_[TI_MAXINDPARAMS] = {0};
+                TI_REAL *outputs_[TI_MAXINDPARAMS] = {0};
+                for (int j = 0; j < info->inputs; ++j) { inputs_[j] = inputs[j] + HALF; }
+                for (int j = 0; j < info->outputs; ++j) { outputs_[j] = outputs_stream_all[j] + MAX(0, ti_stream_get_progress(stream)); }
+                ti_stream_run(stream, INSIZE - HALF, inputs_, outputs_);
+                ti_stream_free(stream);
+
+                int ok = !compare_answers(info, outputs, outputs_stream_all, OUTSIZE, OUTSIZE);
+                if (!ok) {
+                    printf("%s_stream_load/clone mismatched, exiting\n", info->name);
+                    printf("options were: ");
+                    for (int k = 0; k < info->options; ++k) {
+                        printf("%s=%f ", info->option_names[k], options[k]);
+                    }
+                    printf("\n");
+                    exit(1);
+                }
+            }
+
+            if (info->batch_new) {
+                /* symbol s sees the inputs shifted by s bars */
+                const int BARS = INSIZE - NSYMBOLS;
+                const int BATCH_OUTSIZE = MAX(0, BARS - info->start(options));
+                static TI_REAL batch_outputs_mem[NSYMBOLS][TI_MAXINDPARAMS][INSIZE];
+                static TI_REAL symbol_outputs_mem[TI_MAXINDPARAMS][INSIZE];
+                TI_REAL tick_inputs_mem[TI_MAXINDPARAMS][NSYMBOLS];
+                TI_REAL tick_outputs_mem[TI_MAXINDPARAMS][NSYMBOLS];
+                TI_REAL *tick_inputs[TI_MAXINDPARAMS] = {0};
+                TI_REAL *tick_outputs[TI_MAXINDPARAMS] = {0};
+                TI_REAL *symbol_inputs[TI_MAXINDPARAMS] = {0};
+                TI_REAL *symbol_outputs[TI_MAXINDPARAMS] = {0};
+                TI_REAL *batch_outputs[TI_MAXINDPARAMS] = {0};
+                for (int j = 0; j < info->inputs; ++j) { tick_inputs[j] = tick_inputs_mem[j]; }
+                for (int j = 0; j < info->outputs; ++j) { tick_outputs[j] = tick_outputs_mem[j]; }
+
+                ti_batch *batch;
+                int ret = info->batch_new(options, NSYMBOLS, &batch);
+                if (ret != TI_OKAY) {
+                    printf("%s_batch_new returned %i, exiting\n", info->name, ret);
+                    exit(2);
+                }
+                start_ts = clock();
+                for (int bar = 0; bar < BARS; ++bar) {
+                    for (int j = 0; j < info->inputs; ++j) {
+                        for (int s = 0; s < NSYMBOLS; ++s) {
+                            tick_inputs_mem[j][s] = inputs[j][bar + s];
+                        }
+                    }
+                    const int progress = ti_batch_get_progress(batch);
+                    ret = ti_batch_run(batch, (const TI_REAL * const*)tick_inputs, tick_outputs);
+                    if (ret != TI_OKAY) {
+                        printf("%s_batch_run returned %i, exiting\n", info->name, ret);
+                        exit(2);
+                    }
+                    if (progress >= 0) {
+                        for (int j = 0; j < info->outputs; ++j) {
+                            for (int s = 0; s < NSYMBOLS; ++s) {
+                                batch_outputs_mem[s][j][progress] = tick_outputs_mem[j][s];
+                            }
+                        }
+                    }
+                }
+                end_ts = clock();
+                ti_batch_free(batch);
+                elapsed_batch += end_ts - start_ts;
+
+                for (int s = 0; s < NSYMBOLS; ++s) {
+                    for (int j = 0; j < info->inputs; ++j) { symbol_inputs[j] = inputs[j] + s; }
+                    for (int j = 0; j < info->outputs; ++j) {
+                        symbol_outputs[j] = symbol_outputs_mem[j];
+                        batch_outputs[j] = batch_outputs_mem[s][j];
+                    }
+                    info->indicator(BARS, (const TI_REAL * const*)symbol_inputs, options, symbol_outputs);
+                    int ok = !compare_answers(info, symbol_outputs, batch_outputs, BATCH_OUTSIZE, BATCH_OUTSIZE);
+                    if (!ok) {
+                        printf("%s_batch mismatched at symbol %i, exiting\n", info->name, s);
+                        printf("options were: ");
+                        for (int k = 0; k < info->options; ++k) {
+                            printf("%s=%f ", info->option_names[k], options[k]);
+                        }
+                        printf("\n");
+                        exit(1);
+                    }
+                }
+            }
+        }
+
+        if (info->indicator_multi) {
+            /* all the periods at once */
+            enum { NPARAMS = MAX_PERIOD - MIN_PERIOD + 1 };
+            static TI_REAL multi_options[NPARAMS * TI_MAXINDPARAMS];
+            static TI_REAL multi_outputs_mem[TI_MAXINDPARAMS][NPARAMS * INSIZE];
+            static TI_REAL plain_outputs_mem[TI_MAXINDPARAMS][INSIZE];
+            TI_REAL *multi_outputs[TI_MAXINDPARAMS] = {0};
+            TI_REAL *plain_outputs[TI_MAXINDPARAMS] = {0};
+            TI_REAL *param_outputs[TI_MAXINDPARAMS] = {0};
+            for (int j = 0; j < info->outputs; ++j) {
+                multi_outputs[j] = multi_outputs_mem[j];
+                plain_outputs[j] = plain_outputs_mem[j];
+            }
+            for (int p = 0; p < NPARAMS; ++p) {
+                options_setter(MIN_PERIOD + p, multi_options + p * info->options);
+            }
+
+            clock_t start_ts = clock();
+            const int ret = info->indicator_multi(INSIZE, (const TI_REAL * const*)inputs, multi_options, NPARAMS, multi_outputs);
+            clock_t end_ts = clock();
+            elapsed_multi += end_ts - start_ts;
+            if (ret != TI_OKAY) {
+                printf("%s_multi returned %i, exiting\n", info->name, ret);
+                exit(2);
+            }
+
+            for (int p = 0; p < NPARAMS; ++p) {
+                const TI_REAL *options = multi_options + p * info->options;
+                const int OUTSIZE = MAX(0, INSIZE - info->start(options));
+                for (int j = 0; j < info->outputs; ++j) {
+                    param_outputs[j] = multi_outputs[j] + p * INSIZE;
+                }
+                info->indicator(INSIZE, (const TI_REAL * const*)inputs, options, plain_outputs);
+                int ok = !compare_answers(info, plain_outputs, param_outputs, OUTSIZE, OUTSIZE);
+                if (!ok) {
+                    printf("%s_multi mismatched, exiting\n", info->name);
+                    printf("options were: ");
+                    for (int k = 0; k < info->options; ++k) {
+                        printf("%s=%f ", info->option_names[k], options[k]);
+                    }
+                    printf("\n");
+                    exit(1);
+                }
+            }
+        }
+
+        if (info->type != TI_TYPE_SIMPLE) {
+            /* all the periods in one plan, sharing whatever intermediates they have in common */
+            enum { NPARAMS = MAX_PERIOD - MIN_PERIOD + 1 };
+            static TI_REAL plan_options[NPARAMS][TI_MAXINDPARAMS];
+            static TI_REAL plan_outputs_mem[NPARAMS][TI_MAXINDPARAMS][INSIZE];
+            static TI_REAL plain_outputs_mem[TI_MAXINDPARAMS][INSIZE];
+            TI_REAL *plan_outputs[TI_MAXINDPARAMS] = {0};
+            TI_REAL *plain_outputs[TI_MAXINDPARAMS] = {0};
+
+            ti_plan *plan;
+            int ret = ti_plan_new(&plan);
+            for (int p = 0; p < NPARAMS && ret == TI_OKAY; ++p) {
+                options_setter(MIN_PERIOD + p, plan_options[p]);
+                for (int j = 0; j < info->outputs; ++j) { plan_outputs[j] = plan_outputs_mem[p][j]; }
+                ret = ti_plan_add(plan, info - ti_indicators, (const TI_REAL * const*)inputs, plan_options[p], plan_outputs);
+            }
+            if (ret != TI_OKAY) {
+                printf("%s_plan_add returned %i, exiting\n", info->name, ret);
+                exit(2);
+            }
+
+            clock_t start_ts = clock();
+            ret = ti_plan_run(plan, INSIZE);
+            clock_t end_ts = clock();
+            elapsed_plan += end_ts - start_ts;
+            ti_plan_free(plan);
+            if (ret != TI_OKAY) {
+                printf("%s_plan_run returned %i, exiting\n", info->name, ret);
+                exit(2);
+            }
+
+            for (int p = 0; p < NPARAMS; ++p) {
+                const TI_REAL *options = plan_options[p];
+                const int OUTSIZE = MAX(0, INSIZE - info->start(options));
+                for (int j = 0; j < info->outputs; ++j) {
+                    plan_outputs[j] = plan_outputs_mem[p][j];
+                    plain_outputs[j] = plain_outputs_mem[j];
+                }
+                info->indicator(INSIZE, (const TI_REAL * const*)inputs, options, plain_outputs);
+                int ok = !compare_answers(info, plain_outputs, plan_outputs, OUTSIZE, OUTSIZE);
+                if (!ok) {
+                    printf("%s_plan mismatched, exiting\n", info->name);
+                    printf("options were: ");
+                    for (int k = 0; k < info->options; ++k) {
+                        printf("%s=%f ", info->option_names[k], options[k]);
+                    }
+                    printf("\n");
+                    exit(1);
+                }
+            }
         }
     }
 
@@ -506,12 +791,77 @@ void bench(const ti_indicator_info *info) {
     printf("\r");
     printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name, "           ", MS(elapsed_plain), PERFORMANCE(elapsed_plain));
     if (info->indicator_ref) { printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name, "_ref       ", MS(elapsed_ref), PERFORMANCE(elapsed_ref)); }
+    printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name, "_range     ", MS(elapsed_range), PERFORMANCE(elapsed_range));
     if (info->stream_new) { printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name,    "_stream_all", MS(elapsed_stream_all), PERFORMANCE(elapsed_stream_all)); }
     if (info->stream_new) { printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name,    "_stream_1  ", MS(elapsed_stream_1), PERFORMANCE(elapsed_stream_1)); }
+    if (info->indicator_multi) { printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name, "_multi     ", MS(elapsed_multi), PERFORMANCE(elapsed_multi)); }
+    if (info->batch_new) { printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name,     "_batch     ", MS(elapsed_batch), PERFORMANCE(elapsed_batch / NSYMBOLS)); }
+    printf("Benchmark %15s%s\t%5dms\t%5dmfps\n", info->name, "_plan      ", MS(elapsed_plan), PERFORMANCE(elapsed_plan));
 
 	fflush(stdout);
 }
 
+/* The families that share the nodes of a plan, all in one plan at a few periods */
+void check_shared_plan() {
+    static const char *names[] = {
+        "tr", "atr", "natr", "wilders", "dm", "di", "dx", "adx", "adxr", "ce", "kc", "vi", "cmi",
+        "ema", "dema", "tema", "t3", "max", "min", "willr", "stoch", "pc", "aroon", "aroonosc", "ichi", "smi",
+    };
+    enum { NNAMES = sizeof(names) / sizeof(names[0]), NPERIODS = 3 };
+    static const double periods[NPERIODS] = { 4, 14, 15 };
+    static TI_REAL *inputs[NNAMES][TI_MAXINDPARAMS];
+    static TI_REAL options[NNAMES][NPERIODS][TI_MAXINDPARAMS];
+    static TI_REAL outputs_mem[NNAMES][NPERIODS][TI_MAXINDPARAMS][INSIZE];
+    static TI_REAL plain_outputs_mem[TI_MAXINDPARAMS][INSIZE];
+    TI_REAL *outputs[TI_MAXINDPARAMS] = {0};
+    TI_REAL *plain_outputs[TI_MAXINDPARAMS] = {0};
+
+    printf("Running: shared plan ");
+    fflush(stdout);
+
+    ti_plan *plan;
+    int ret = ti_plan_new(&plan);
+    for (int n = 0; n < NNAMES && ret == TI_OKAY; ++n) {
+        const ti_indicator_info *info = ti_find_indicator(names[n]);
+        assert(info);
+        find_inputs(info, inputs[n]);
+        for (int p = 0; p < NPERIODS && ret == TI_OKAY; ++p) {
+            find_option_setter(info)(periods[p], options[n][p]);
+            for (int j = 0; j < info->outputs; ++j) { outputs[j] = outputs_mem[n][p][j]; }
+            ret = ti_plan_add(plan, info - ti_indicators, (const TI_REAL * const*)inputs[n], options[n][p], outputs);
+        }
+    }
+    if (ret == TI_OKAY) { ret = ti_plan_run(plan, INSIZE); }
+    ti_plan_free(plan);
+    if (ret != TI_OKAY) {
+        printf("shared plan returned %i, exiting\n", ret);
+        exit(2);
+    }
+
+    for (int n = 0; n < NNAMES; ++n) {
+        const ti_indicator_info *info = ti_find_indicator(names[n]);
+        for (int p = 0; p < NPERIODS; ++p) {
+            const int OUTSIZE = MAX(0, INSIZE - info->start(options[n][p]));
+            for (int j = 0; j < info->outputs; ++j) {
+                outputs[j] = outputs_mem[n][p][j];
+                plain_outputs[j] = plain_outputs_mem[j];
+            }
+            info->indicator(INSIZE, (const TI_REAL * const*)inputs[n], options[n][p], plain_outputs);
+            if (compare_answers(info, plain_outputs, outputs, OUTSIZE, OUTSIZE)) {
+                printf("%s_plan mismatched in the shared plan, exiting\n", info->name);
+                printf("options were: ");
+                for (int k = 0; k < info->options; ++k) {
+                    printf("%s=%f ", info->option_names[k], options[n][p][k]);
+                }
+                printf("\n");
+                exit(1);
+            }
+        }
+    }
+    printf("\rShared plan of %d requests matched\n", NNAMES * NPERIODS);
+    fflush(stdout);
+}
+
 int main(int argc, char** argv) {
     generate_inputs();
 
@@ -529,5 +879,6 @@ int main(int argc, char** argv) {
         for (int i = 0; i < TI_INDICATOR_COUNT; ++i) {
             bench(info + i);
         }
+        check_shared_plan();
     }
 }
@@ -10,6 +10,7 @@
 #include <assert.h>
 #include <signal.h>
 #include <algorithm>
+#include <cstring>
 #include <cmath>
 #include <vector>
 #include "../utils/log.h"
@@ -90,7 +91,40 @@ void stress(const ti_indicator_info& info) {
         if (result == TI_OKAY) {
             info.stream_run(stream, size, inputs, outputs);
             check_output(info, outsize, outputs);
+
+            TI_REAL peek_mem[TI_MAXINDPARAMS];
+            std::vector<TI_REAL*> peek_inputs(info.inputs), peek_outputs(info.outputs);
+            for (int i = 0; i < info.inputs; ++i) { peek_inputs[i] = source[i]; }
+            for (int i = 0; i < info.outputs; ++i) { peek_outputs[i] = peek_mem + i; }
+            ti_stream_peek(stream, peek_inputs.data(), peek_outputs.data());
+
+            std::vector<char> buf(ti_stream_serialized_size(stream));
+            ti_stream_save(stream, buf.data());
             info.stream_free(stream);
+            if (ti_stream_load(buf.data(), &stream) == TI_OKAY) {
+                ti_stream *clone;
+                if (ti_stream_clone(stream, &clone) == TI_OKAY) {
+                    ti_stream_clone_into(stream, clone);
+                    ti_stream_free(clone);
+                }
+                ti_stream_free(stream);
+            }
+            if (info.options > 0) {
+                /* the state saved with other options than these must be refused or made consistent */
+                TI_REAL option;
+                std::memcpy(&option, buf.data() + 48, sizeof(option));
+                option = option * 2 + 1;
+                std::memcpy(buf.data() + 48, &option, sizeof(option));
+                if (ti_stream_load(buf.data(), &stream) == TI_OKAY) {
+                    std::vector<TI_REAL> rerun_mem(std::max(size, 1) * info.outputs);
+                    std::vector<TI_REAL*> rerun_outputs(info.outputs);
+                    for (int i = 0; i < info.outputs; ++i) { rerun_outputs[i] = rerun_mem.data() + i * std::max(size, 1); }
+                    info.stream_run(stream, size, inputs, rerun_outputs.data());
+                    ti_stream_free(stream);
+                }
+            }
+            buf[4] ^= 1;
+            if (ti_stream_load(buf.data(), &stream) == TI_OKAY) { ti_stream_free(stream); }
         }
 
         for (int i = 0; i < info.inputs; ++i) { delete[] inputs[i]; }
@@ -99,6 +133,70 @@ void stress(const ti_indicator_info& info) {
         delete[] outputs;
     };
 
+    auto test_multi = [&](int size, TI_REAL source[TI_MAXINDPARAMS][N], const char* msg = "") {
+        printf("m%i%s ", size, msg);
+        fflush(stdout);
+
+        /* the fuzzed options followed by the same options with the first one doubled */
+        const int nparams = 2;
+        std::vector<TI_REAL> multi_options(nparams * info.options);
+        std::copy(options.begin(), options.end(), multi_options.begin());
+        std::copy(options.begin(), options.end(), multi_options.begin() + info.options);
+        if (info.options) { multi_options[info.options] *= 2; }
+
+        std::vector<TI_REAL*> inputs(info.inputs);
+        for (int i = 0; i < info.inputs; ++i) { inputs[i] = source[i]; }
+        std::vector<TI_REAL> outputs_mem(info.outputs * nparams * std::max(size, 1));
+        std::vector<TI_REAL*> outputs(info.outputs);
+        for (int i = 0; i < info.outputs; ++i) { outputs[i] = outputs_mem.data() + i * nparams * std::max(size, 1); }
+
+        info.indicator_multi(size, inputs.data(), multi_options.data(), nparams, outputs.data());
+    };
+    auto test_range = [&](int size, TI_REAL source[TI_MAXINDPARAMS][N], const char* msg = "") {
+        printf("r%i%s ", size, msg);
+        fflush(stdout);
+
+        /* the second half of the outputs, then the last one, then one past the end */
+        const int outsize = size - info.start(options.data());
+        const int slices[3][2] = {{outsize / 2, outsize - outsize / 2}, {outsize - 1, 1}, {outsize, 1}};
+
+        std::vector<TI_REAL*> inputs(info.inputs);
+        for (int i = 0; i < info.inputs; ++i) { inputs[i] = source[i]; }
+        std::vector<TI_REAL> outputs_mem(info.outputs * std::max(size, 1));
+        std::vector<TI_REAL*> outputs(info.outputs);
+        for (int i = 0; i < info.outputs; ++i) { outputs[i] = outputs_mem.data() + i * std::max(size, 1); }
+
+        for (auto& slice : slices) {
+            info.indicator_range(size, inputs.data(), options.data(), slice[0], slice[1], outputs.data());
+        }
+    };
+    auto test_batch = [&](int size, TI_REAL source[TI_MAXINDPARAMS][N], const char* msg = "") {
+        printf("b%i%s ", size, msg);
+        fflush(stdout);
+
+        const int nsymbols = 2;
+        std::vector<TI_REAL> inputs_mem(info.inputs * nsymbols);
+        std::vector<TI_REAL> outputs_mem(info.outputs * nsymbols);
+        std::vector<TI_REAL*> inputs(info.inputs);
+        std::vector<TI_REAL*> outputs(info.outputs);
+        for (int i = 0; i < info.inputs; ++i) { inputs[i] = inputs_mem.data() + i * nsymbols; }
+        for (int i = 0; i < info.outputs; ++i) { outputs[i] = outputs_mem.data() + i * nsymbols; }
+
+        ti_batch *batch;
+        int result = info.batch_new(options.data(), nsymbols, &batch);
+        if (result == TI_OKAY) {
+            for (int bar = 0; bar < size; ++bar) {
+                for (int i = 0; i < info.inputs; ++i) {
+                    for (int s = 0; s < nsymbols; ++s) {
+                        inputs[i][s] = source[i][(bar + s) % N];
+                    }
+                }
+                info.batch_run(batch, inputs.data(), outputs.data());
+            }
+            info.batch_free(batch);
+        }
+    };
+
     // please note that std::pow doesn't compute in exact even with integers
     for (unsigned option_bitset = 0; option_bitset < std::pow(M, info.options) + 1; ++option_bitset) {
         for (int i = 0; i < info.options; ++i) {
@@ -129,6 +227,31 @@ void stress(const ti_indicator_info& info) {
             test_stream(N, g_input_dups, "x1");
         }
 
+        test_range(0, g_input);
+        test_range(1, g_input);
+        test_range(5, g_input);
+        test_range(N, g_input);
+        test_range(N, g_input_zeros, "x0");
+        test_range(N, g_input_dups, "x1");
+
+        if (info.indicator_multi) {
+            test_multi(0, g_input);
+            test_multi(1, g_input);
+            test_multi(5, g_input);
+            test_multi(N, g_input);
+            test_multi(N, g_input_zeros, "x0");
+            test_multi(N, g_input_dups, "x1");
+        }
+
+        if (info.batch_new) {
+            test_batch(0, g_input);
+            test_batch(1, g_input);
+            test_batch(5, g_input);
+            test_batch(N, g_input);
+            test_batch(N, g_input_zeros, "x0");
+            test_batch(N, g_input_dups, "x1");
+        }
+
         printf("\r%140s\r", "");
     };
     printf("%s\n", info.name);
@@ -0,0 +1,73 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+
+#ifndef __DISPATCH_H__
+#define __DISPATCH_H__
+
+#include <math.h>
+
+/* TI_DISPATCH marks a function whose loops are worth vectorizing for
+ * the wider instruction sets. The compiler emits a clone per target
+ * (sse2, avx2, avx512f) and the dynamic loader picks one by cpuid when
+ * the library is loaded (an ifunc), so the build itself stays at the
+ * baseline -O2. It expands to nothing where ifuncs are unavailable
+ * (MSVC, macOS, non-x86); define TI_NO_DISPATCH to force the baseline.
+ *
+ * TI_SIMD goes right before such a loop: -O2 only vectorizes the loops
+ * that need neither an alias check nor an epilogue, `omp simd`
+ * (-fopenmp-simd, no runtime) vectorizes the loop regardless. The
+ * iterations must be independent; an output may still alias the input
+ * of the same iteration.
+ */
+
+#if defined(__has_attribute)
+#  if __has_attribute(target_clones) && defined(__x86_64__) && defined(__gnu_linux__) \
+      && !defined(TI_NO_DISPATCH)
+#    define TI_DISPATCH __attribute__((target_clones("default", "avx2", "avx512f")))
+#  endif
+#endif
+
+#ifndef TI_DISPATCH
+#define TI_DISPATCH
+#endif
+
+#if defined(__GNUC__)
+#define TI_SIMD _Pragma("omp simd")
+#else
+#define TI_SIMD
+#endif
+
+/* The transcendentals of glibc's libmvec (2.35+) in the vector widths of
+ * every clone. glibc only declares them under -ffast-math, whereas the
+ * release build keeps -fno-finite-math-only, so they are declared here
+ * whenever errno is off, i.e. the accuracy of fast math is accepted
+ * (libmvec is within 4 ulp).
+ */
+
+#if defined(__cplusplus) && defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) \
+    && defined(__GLIBC__) && defined(__GLIBC_PREREQ) && defined(__NO_MATH_ERRNO__) \
+    && !defined(__FAST_MATH__) && !defined(TI_NO_DISPATCH)
+#  if __GLIBC_PREREQ(2, 35)
+#    define TI_VECTOR_MATH(name) extern "C" __attribute__((__simd__("notinbranch"))) double name(double) __THROW;
+TI_VECTOR_MATH(acos)
+TI_VECTOR_MATH(asin)
+TI_VECTOR_MATH(atan)
+TI_VECTOR_MATH(cos)
+TI_VECTOR_MATH(cosh)
+TI_VECTOR_MATH(exp)
+TI_VECTOR_MATH(log)
+TI_VECTOR_MATH(log10)
+TI_VECTOR_MATH(sin)
+TI_VECTOR_MATH(sinh)
+TI_VECTOR_MATH(tan)
+TI_VECTOR_MATH(tanh)
+#    undef TI_VECTOR_MATH
+#  endif
+#endif
+
+
+#endif /*__DISPATCH_H__*/
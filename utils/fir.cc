@@ -0,0 +1,170 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#include "fir.hh"
+#include "dispatch.h"
+
+#include <new>
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+static const int fir_block = 256;
+static const int fir_lanes = 8;
+static const int fir_fft_period = 128;
+static const int fir_fft_factor = 4;
+
+/* in-place radix-2 fft of (re, im), n a power of two, unnormalized.
+   twiddles[h+k] = exp(-i pi k/h) for the butterflies of half-size h, h = 1, 2, .. n/2 */
+TI_DISPATCH
+static void fft(TI_REAL *re, TI_REAL *im, int n, TI_REAL const *twiddle_re, TI_REAL const *twiddle_im, bool inverse) {
+    for (int i = 1, j = 0; i < n; ++i) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) { j ^= bit; }
+        j ^= bit;
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+    const TI_REAL sign = inverse ? -1 : 1;
+    for (int h = 1; h < n; h *= 2) {
+        for (int i = 0; i < n; i += 2*h) {
+            TI_REAL *const are = re + i, *const aim = im + i;
+            TI_REAL *const bre = re + i + h, *const bim = im + i + h;
+            TI_SIMD
+            for (int k = 0; k < h; ++k) {
+                const TI_REAL wr = twiddle_re[h+k];
+                const TI_REAL wi = sign * twiddle_im[h+k];
+                const TI_REAL tr = wr * bre[k] - wi * bim[k];
+                const TI_REAL ti = wr * bim[k] + wi * bre[k];
+                bre[k] = are[k] - tr;
+                bim[k] = aim[k] - ti;
+                are[k] += tr;
+                aim[k] += ti;
+            }
+        }
+    }
+}
+
+/* the outputs first..first+count-1, fir_block at a time */
+TI_DISPATCH
+static void fir_direct(TI_REAL const *weights, int period, TI_REAL scale, TI_REAL const *series, int first, int count, TI_REAL *out) {
+    TI_REAL sum[fir_block];
+
+    for (int k = first; k < first + count; k += fir_block) {
+        const int n = first + count - k < fir_block ? first + count - k : fir_block;
+        TI_REAL const *const newest = series + k + period - 1;
+        for (int b = 0; b < n; ++b) {
+            sum[b] = 0;
+        }
+        for (int j = 0; j < period; ++j) {
+            const TI_REAL w = weights[j];
+            TI_REAL const *const x = newest - j;
+            TI_SIMD
+            for (int b = 0; b < n; ++b) {
+                sum[b] += w * x[b];
+            }
+        }
+        TI_SIMD
+        for (int b = 0; b < n; ++b) {
+            out[k+b] = sum[b] * scale;
+        }
+    }
+}
+
+/* overlap-save: blocks of n inputs give n-period+1 outputs each, two blocks per transform
+   as the real and the imaginary part, the weights being real. A nan or an inf would spread
+   over the whole transform, so the blocks holding one are computed directly instead.
+   false if out of memory */
+static bool fir_fft(TI_REAL const *weights, int period, TI_REAL scale, TI_REAL const *series, int size, TI_REAL *out) try {
+    const int count = size - period + 1;
+    int n = 2;
+    while (n < fir_fft_factor * period && n < size + period) { n *= 2; }
+    const int step = n - period + 1;
+
+    std::vector<TI_REAL> twiddle_re(n), twiddle_im(n);
+    for (int h = 1; h < n; h *= 2) {
+        for (int k = 0; k < h; ++k) {
+            twiddle_re[h+k] = cos(3.14159265358979323846 * k / h);
+            twiddle_im[h+k] = -sin(3.14159265358979323846 * k / h);
+        }
+    }
+
+    std::vector<TI_REAL> hre(n), him(n), re(n), im(n);
+    for (int j = 0; j < period; ++j) {
+        hre[j] = weights[j] * scale / n;
+    }
+    fft(hre.data(), him.data(), n, twiddle_re.data(), twiddle_im.data(), false);
+
+    for (int k = 0; k < count; k += 2*step) {
+        /* window of the output k starts at series[k] */
+        bool finite = true;
+        for (int m = 0; m < n; ++m) {
+            re[m] = k + m < size ? series[k + m] : 0;
+            im[m] = k + step + m < size ? series[k + step + m] : 0;
+            finite = finite && std::isfinite(re[m]) && std::isfinite(im[m]);
+        }
+        if (!finite) {
+            fir_direct(weights, period, scale, series, k, std::min(2*step, count - k), out);
+            continue;
+        }
+        fft(re.data(), im.data(), n, twiddle_re.data(), twiddle_im.data(), false);
+        TI_SIMD
+        for (int m = 0; m < n; ++m) {
+            const TI_REAL r = re[m] * hre[m] - im[m] * him[m];
+            im[m] = re[m] * him[m] + im[m] * hre[m];
+            re[m] = r;
+        }
+        fft(re.data(), im.data(), n, twiddle_re.data(), twiddle_im.data(), true);
+        for (int m = 0; m < step && k + m < count; ++m) {
+            out[k + m] = re[period - 1 + m];
+        }
+        for (int m = 0; m < step && k + step + m < count; ++m) {
+            out[k + step + m] = im[period - 1 + m];
+        }
+    }
+
+    return true;
+} catch (std::bad_alloc& e) {
+    return false;
+}
+
+TI_DISPATCH
+void fir_run(TI_REAL const *weights, int period, TI_REAL scale, TI_REAL const *series, int size, TI_REAL *out) {
+    const int count = size - period + 1;
+    if (period >= fir_fft_period && count >= period && fir_fft(weights, period, scale, series, size, out)) { return; }
+    fir_direct(weights, period, scale, series, 0, count, out);
+}
+
+/* sum of a[j]*b[j], fir_lanes partial sums */
+static inline TI_REAL dot(TI_REAL const *a, TI_REAL const *b, int n) {
+    TI_REAL sum[fir_lanes] = {0};
+    int j = 0;
+    for (; j + fir_lanes <= n; j += fir_lanes) {
+        TI_SIMD
+        for (int l = 0; l < fir_lanes; ++l) {
+            sum[l] += a[j+l] * b[j+l];
+        }
+    }
+    TI_REAL result = 0;
+    for (; j < n; ++j) {
+        result += a[j] * b[j];
+    }
+    for (int l = 0; l < fir_lanes; ++l) {
+        result += sum[l];
+    }
+    return result;
+}
+
+TI_DISPATCH
+TI_REAL fir_dot(TI_REAL const *weights, int period, ringbuf<0> const &price) {
+    /* the ring runs newest to oldest from pos upwards, then wraps around to 0 */
+    TI_REAL const *const buf = price.buf.get();
+    const int first = period < price.M - price.pos ? period : price.M - price.pos;
+    return dot(weights, buf + price.pos, first) + dot(weights + first, buf, period - first);
+}
@@ -0,0 +1,31 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+#include "ringbuf.hh"
+
+/*
+    Fixed-weight FIR filter, out_i = scale * sum_{j<period} weights[j] * x_{i-j}:
+    weights[j] is the weight of the value j bars ago, precomputed once by the indicator.
+
+    fir_run(): the outputs for bars period-1..size-1 of a series. The outputs are computed
+        fir_block at a time: every weight is broadcast once per block and multiplied by
+        a contiguous slice of the input into the sums of the block, which stay in L1.
+        From fir_fft_period taps on, it convolves by fft instead (overlap-save), in
+        O(log period) per output; the crossover was measured by timing fir_run alone on
+        200k bars at periods up to 2000. The blocks with a nan or an inf in their inputs
+        are computed directly, so that it spreads over the same outputs as in the plain loop.
+    fir_dot(): the output at the newest bar of a ringbuf<0> holding at least period values,
+        as the dot products of the weights with the two contiguous runs of the ring.
+
+    Both are cloned per cpu (dispatch.h). The lags are summed in the same order as by
+    the plain loop in fir_run(), not in fir_dot().
+*/
+
+void fir_run(TI_REAL const *weights, int period, TI_REAL scale, TI_REAL const *series, int size, TI_REAL *out);
+TI_REAL fir_dot(TI_REAL const *weights, int period, ringbuf<0> const &price);
@@ -0,0 +1,162 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+
+#include <vector>
+#include <algorithm>
+
+/*
+    Convex hull of a sliding window of points (x, y), x increasing: https://cp-algorithms.com/geometry/convex_hull_trick.html
+
+    push(x, y): adds the newest point, amortized O(1)
+    push(x, y_upper, y_lower): the same, but max/argmax are taken over y_upper and min/argmin
+        over y_lower, e.g. the highs and the lows
+    pop(): drops the oldest point, amortized O(log n)
+    max(s), min(s): the max/min of y - s*x over the window, O(log n)
+    argmax(s), argmin(s): the point where it is reached; when subtracting two of these values,
+        (a.y - b.y) - s*(a.x - b.x) doesn't lose the precision to large x
+    bands(t, s, &max, &min): max/min(s) moved to the line through x = t, that is the max/min of
+        y + (t - x)*s, e.g. the projection bands of the highs and the lows with slopes s
+
+    Each hull is a queue of two stacks. The newer points make a monotone chain on the back,
+    the older ones a hull on the front built from the newest to the oldest with an undo log,
+    so that dropping the oldest point is undoing its insertion. When the front runs empty,
+    the whole back is moved onto it.
+*/
+
+struct sliding_hull {
+    struct point { TI_REAL x, y; };
+
+    /* the upper hull, answers max(y - s*x) */
+    struct chain {
+        struct undo { int pos, n; point saved; };
+
+        std::vector<point> pending; /* the points of the back, oldest first */
+        std::vector<point> back;    /* the hull of pending, x increasing */
+        std::vector<point> front;   /* x decreasing, front[n-1] is the oldest */
+        std::vector<undo> log;      /* one per point of the front, the oldest last */
+        int n = 0;                  /* the hull of the front is front[0..n) */
+
+        /* whether b stays on the upper hull of a, b, c given a.x < b.x < c.x */
+        static bool convex(point const &a, point const &b, point const &c) {
+            return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x) < 0;
+        }
+
+        void reserve(int capacity) {
+            pending.reserve(capacity);
+            back.reserve(capacity);
+            front.resize(capacity);
+            log.reserve(capacity);
+        }
+
+        void clear() {
+            pending.clear();
+            back.clear();
+            log.clear();
+            n = 0;
+        }
+
+        int size() const { return pending.size() + log.size(); }
+
+        void push(point p) {
+            pending.push_back(p);
+            while (back.size() >= 2 && !convex(back[back.size()-2], back.back(), p)) { back.pop_back(); }
+            back.push_back(p);
+        }
+
+        /* p is to the left of all the front */
+        void push_front(point p) {
+            int lo = 1, hi = n; /* the new length of the kept part is in [lo, hi] */
+            if (n <= 1) { lo = hi = n; }
+            while (lo < hi) {
+                const int mid = (lo + hi + 1) / 2;
+                if (convex(p, front[mid-1], front[mid-2])) { lo = mid; } else { hi = mid - 1; }
+            }
+            log.push_back(undo{lo, n, front[lo]});
+            front[lo] = p;
+            n = lo + 1;
+        }
+
+        void pop() {
+            if (log.empty()) {
+                if ((int)front.size() < (int)pending.size()) { front.resize(pending.size()); }
+                for (int i = pending.size() - 1; i >= 0; --i) { push_front(pending[i]); }
+                pending.clear();
+                back.clear();
+            }
+            const undo u = log.back();
+            log.pop_back();
+            front[u.pos] = u.saved;
+            n = u.n;
+        }
+
+        template<class At>
+        static point query(At at, int count, TI_REAL s) {
+            /* y - s*x grows along the hull while the edges are steeper than s */
+            int lo = 0, hi = count - 1;
+            while (lo < hi) {
+                const int mid = (lo + hi) / 2;
+                point const &a = at(mid), &b = at(mid+1);
+                if (b.y - a.y > s * (b.x - a.x)) { lo = mid + 1; } else { hi = mid; }
+            }
+            return at(lo);
+        }
+
+        point argmax(TI_REAL s) const {
+            if (!n) { return query([&](int k) -> point const& { return back[k]; }, back.size(), s); }
+            const point a = query([&](int k) -> point const& { return front[n-1-k]; }, n, s);
+            if (back.empty()) { return a; }
+            const point b = query([&](int k) -> point const& { return back[k]; }, back.size(), s);
+            return (b.y - a.y) - s * (b.x - a.x) > 0 ? b : a;
+        }
+    };
+
+    chain upper, lower; /* lower holds the points mirrored over the x axis */
+
+    void reserve(int capacity) {
+        upper.reserve(capacity);
+        lower.reserve(capacity);
+    }
+    void clear() {
+        upper.clear();
+        lower.clear();
+    }
+    int size() const { return upper.size(); }
+
+    void push(TI_REAL x, TI_REAL y) {
+        push(x, y, y);
+    }
+    void push(TI_REAL x, TI_REAL y_upper, TI_REAL y_lower) {
+        upper.push(point{x, y_upper});
+        lower.push(point{x, -y_lower});
+    }
+    void pop() {
+        upper.pop();
+        lower.pop();
+    }
+
+    point argmax(TI_REAL s) const { return upper.argmax(s); }
+    point argmin(TI_REAL s) const {
+        const point p = lower.argmax(-s);
+        return point{p.x, -p.y};
+    }
+    TI_REAL max(TI_REAL s) const {
+        const point p = argmax(s);
+        return p.y - s * p.x;
+    }
+    TI_REAL min(TI_REAL s) const {
+        const point p = argmin(s);
+        return p.y - s * p.x;
+    }
+    void bands(TI_REAL t, TI_REAL s, TI_REAL *the_max, TI_REAL *the_min) const {
+        const point hi = argmax(s), lo = argmin(s);
+        *the_max = hi.y + (t - hi.x) * s;
+        *the_min = lo.y + (t - lo.x) * s;
+    }
+};
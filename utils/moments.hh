@@ -0,0 +1,56 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+#include "ringbuf.hh"
+
+/*
+    Mean and variance of a sliding window of period values, for the streams of the rolling statistics.
+
+    The window is kept as its mean and m2, the sum of the squared deviations from the mean (Welford),
+    rather than as the sums of x and x^2, so that the variance doesn't lose its digits to the square
+    of a large mean.
+
+    slide(x, oldest, per): x replaces the oldest value of the full window, O(1)
+    refresh(window, period, per): both recomputed in two passes over window[0..period); the streams
+        call it on the first full window and every period bars after, which bounds the rounding
+        accumulated by the slides at O(1) amortized
+    var(per): the population variance
+
+    per is 1/period.
+*/
+
+struct rolling_moments {
+    TI_REAL mean;
+    TI_REAL m2;
+
+    void slide(TI_REAL x, TI_REAL oldest, TI_REAL per) {
+        const TI_REAL diff = x - oldest;
+        const TI_REAL old_mean = mean;
+        mean += diff * per;
+        m2 += diff * ((x - mean) + (oldest - old_mean));
+        if (m2 < 0) { m2 = 0; }
+    }
+
+    void refresh(ringbuf<0> const &window, int period, TI_REAL per) {
+        TI_REAL sum = 0;
+        for (int j = 0; j < period; ++j) {
+            sum += window[j];
+        }
+        mean = sum * per;
+        m2 = 0;
+        for (int j = 0; j < period; ++j) {
+            const TI_REAL d = window[j] - mean;
+            m2 += d * d;
+        }
+    }
+
+    TI_REAL var(TI_REAL per) const {
+        return m2 * per;
+    }
+};
@@ -0,0 +1,52 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+
+/*
+    Helpers for the ti_xxx_multi kernels, which evaluate one indicator for
+    many sets of options in a single pass over the input.
+
+    The options are an nparams x noptions matrix, the output j of the p-th
+    set of options is written to outputs[j] + p*size.
+*/
+
+/* Row p of the options matrix */
+inline TI_REAL const *multi_options(TI_REAL const *options, int noptions, int p) {
+    return options + (size_t)p * noptions;
+}
+
+/* Output j of the p-th set of options */
+inline TI_REAL *multi_output(TI_REAL *const *outputs, int j, int size, int p) {
+    return outputs[j] + (size_t)p * size;
+}
+
+/* Recursive kernels go tile by tile, so that a tile of shared input stays in L1 for all option sets */
+const int multi_tile = 512;
+
+/*
+    Prefix sums make a windowed sum O(1) for any period:
+    sum(x[i-period+1..i]) == s[i+1] - s[i-period+1].
+
+    The terms are computed from x[k] - shift, shift being typically x[0].
+    That keeps the magnitude of the sums (and thus the cancellation error
+    of the subtraction) proportional to the range of the series rather
+    than to its level.
+
+    prefix_sum(): s[0] = 0, s[k+1] = s[k] + f(k, x[k] - shift)
+*/
+
+template<class F>
+void prefix_sum(int size, TI_REAL const *x, TI_REAL shift, TI_REAL *s, F f) {
+    TI_REAL acc = 0;
+    s[0] = 0;
+    for (int k = 0; k < size; ++k) {
+        acc += f(k, x[k] - shift);
+        s[k+1] = acc;
+    }
+}
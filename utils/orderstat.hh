@@ -0,0 +1,257 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+
+#include <vector>
+#include <algorithm>
+
+/*
+    Order-statistic multiset of reals: a treap (https://en.wikipedia.org/wiki/Treap) with subtree sizes,
+    its nodes live in a flat pool allocated once, so a rolling window of a fixed capacity never allocates.
+
+    insert(), erase(): O(log n); erase() removes one instance of the value, if any
+    select(k): the k-th smallest value, 0-based, O(log n)
+    select_deviation(m, j): the j-th smallest of |x - select(m)| over all the values, O(log^2 n)
+    sum(), sum_below(x, count): the sum of all the values / of the values < x and their count, O(log n);
+        the subtree sums are recomputed from the children on every update, so they don't drift
+    sum_deviation(c): the sum of |x - c| over all the values, O(log n)
+
+    NaN is ordered above all the other values and equal to itself, so that a NaN that was inserted can be erased.
+*/
+
+struct orderstat {
+    struct node {
+        TI_REAL value;
+        TI_REAL sum;
+        unsigned priority;
+        int left, right, size;
+    };
+
+    std::vector<node> nodes; /* nodes[0] is the empty tree */
+    std::vector<int> freelist;
+    int root = 0;
+    unsigned seed = 2463534242u;
+
+    orderstat() { reserve(0); }
+    explicit orderstat(int capacity) { reserve(capacity); }
+
+    /* drops the contents */
+    void reserve(int capacity) {
+        nodes.assign(capacity + 1, node{0, 0, 0, 0, 0, 0});
+        freelist.resize(capacity);
+        for (int i = 0; i < capacity; ++i) { freelist[i] = capacity - i; }
+        root = 0;
+    }
+
+    int size() const { return nodes[root].size; }
+    int capacity() const { return nodes.size() - 1; }
+
+    void insert(TI_REAL x) {
+        assert(!freelist.empty());
+        const int n = freelist.back();
+        freelist.pop_back();
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        nodes[n] = node{x, x, seed, 0, 0, 1};
+        root = insert(root, n);
+    }
+
+    void erase(TI_REAL x) {
+        root = erase(root, x);
+    }
+
+    TI_REAL select(int k) const {
+        assert(k >= 0 && k < size());
+        int t = root;
+        while (true) {
+            const int left = nodes[nodes[t].left].size;
+            if (k < left) { t = nodes[t].left; }
+            else if (k == left) { return nodes[t].value; }
+            else { k -= left + 1; t = nodes[t].right; }
+        }
+    }
+
+    TI_REAL sum() const { return nodes[root].sum; }
+
+    TI_REAL sum_below(TI_REAL x, int &count) const {
+        TI_REAL acc = 0;
+        count = 0;
+        int t = root;
+        while (t) {
+            if (nodes[t].value < x) {
+                acc += nodes[nodes[t].left].sum + nodes[t].value;
+                count += nodes[nodes[t].left].size + 1;
+                t = nodes[t].right;
+            } else {
+                t = nodes[t].left;
+            }
+        }
+        return acc;
+    }
+
+    TI_REAL sum_deviation(TI_REAL c) const {
+        int count_below;
+        const TI_REAL below = sum_below(c, count_below);
+        const TI_REAL above = sum() - below;
+        return (count_below * c - below) + (above - (size() - count_below) * c);
+    }
+
+    TI_REAL select_deviation(int m, int j) const {
+        assert(m >= 0 && m < size());
+        assert(j >= 0 && j < size());
+        if (j == 0) { return 0; }
+
+        /* the deviations below and above the center are two sorted sequences, */
+        /* look for the (j-1)-th smallest of their union */
+        const TI_REAL center = select(m);
+        const int a = m;
+        const int b = size() - 1 - m;
+        auto below = [&](int t) { return fabs(select(m - 1 - t) - center); };
+        auto above = [&](int t) { return fabs(select(m + 1 + t) - center); };
+
+        const int q = j - 1;
+        int lo = std::max(0, q + 1 - b);
+        int hi = std::min(a, q + 1);
+        while (lo < hi) {
+            const int i = (lo + hi) / 2;
+            if (below(i) < above(q - i)) { lo = i + 1; } else { hi = i; }
+        }
+        const int i = lo;
+        if (i == 0) { return above(q); }
+        if (q + 1 - i == 0) { return below(i - 1); }
+        return std::max(below(i - 1), above(q - i));
+    }
+
+    static bool less(TI_REAL a, TI_REAL b) { return a < b || (b != b && a == a); }
+    static bool same(TI_REAL a, TI_REAL b) { return a == b || (a != a && b != b); }
+
+private:
+
+    void update(int t) {
+        nodes[t].size = nodes[nodes[t].left].size + nodes[nodes[t].right].size + 1;
+        nodes[t].sum = nodes[nodes[t].left].sum + nodes[nodes[t].right].sum + nodes[t].value;
+    }
+
+    /* l gets the values < x, r gets the rest */
+    void split(int t, TI_REAL x, int &l, int &r) {
+        if (!t) { l = r = 0; return; }
+        if (less(nodes[t].value, x)) {
+            split(nodes[t].right, x, nodes[t].right, r);
+            l = t;
+        } else {
+            split(nodes[t].left, x, l, nodes[t].left);
+            r = t;
+        }
+        update(t);
+    }
+
+    int merge(int l, int r) {
+        if (!l || !r) { return l ? l : r; }
+        if (nodes[l].priority > nodes[r].priority) {
+            nodes[l].right = merge(nodes[l].right, r);
+            update(l);
+            return l;
+        } else {
+            nodes[r].left = merge(l, nodes[r].left);
+            update(r);
+            return r;
+        }
+    }
+
+    int insert(int t, int n) {
+        if (!t) { return n; }
+        if (nodes[n].priority > nodes[t].priority) {
+            split(t, nodes[n].value, nodes[n].left, nodes[n].right);
+            update(n);
+            return n;
+        }
+        if (less(nodes[n].value, nodes[t].value)) {
+            nodes[t].left = insert(nodes[t].left, n);
+        } else {
+            nodes[t].right = insert(nodes[t].right, n);
+        }
+        update(t);
+        return t;
+    }
+
+    int erase(int t, TI_REAL x) {
+        if (!t) { return 0; }
+        if (same(x, nodes[t].value)) {
+            const int r = merge(nodes[t].left, nodes[t].right);
+            freelist.push_back(t);
+            return r;
+        }
+        if (less(x, nodes[t].value)) {
+            nodes[t].left = erase(nodes[t].left, x);
+        } else {
+            nodes[t].right = erase(nodes[t].right, x);
+        }
+        update(t);
+        return t;
+    }
+};
+
+
+/*
+    The order statistics of a short window kept in a sorted array, with the interface of orderstat:
+    insert() and erase() move the values above the position, O(n) but a single memmove, and select() is O(1).
+    Up to a few thousand values this beats the treap, whose every step is a dependent load.
+*/
+
+struct sorted_window {
+    std::vector<TI_REAL> values;
+    int cap = 0;
+
+    sorted_window() = default;
+    explicit sorted_window(int capacity) { reserve(capacity); }
+
+    /* drops the contents */
+    void reserve(int capacity) {
+        values.clear();
+        values.reserve(capacity);
+        cap = capacity;
+    }
+
+    int size() const { return values.size(); }
+    int capacity() const { return cap; }
+
+    void insert(TI_REAL x) {
+        assert(size() < capacity());
+        values.insert(std::upper_bound(values.begin(), values.end(), x, orderstat::less), x);
+    }
+
+    void erase(TI_REAL x) {
+        auto it = std::lower_bound(values.begin(), values.end(), x, orderstat::less);
+        if (it != values.end() && orderstat::same(*it, x)) { values.erase(it); }
+    }
+
+    TI_REAL select(int k) const {
+        assert(k >= 0 && k < size());
+        return values[k];
+    }
+};
+
+
+/* The sum of |x[j] - c| over n values, the direct counterpart of orderstat::sum_deviation for the
+   windows that are too short for the tree to pay off. From 32 values up it keeps four partial sums,
+   so that the additions don't wait on one another; below, the paired loads that the compiler makes
+   of them stall on the value the caller has just stored into the window, and cost more than they save. */
+inline TI_REAL sum_deviation(TI_REAL const *x, int n, TI_REAL c) {
+    TI_REAL acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+    int j = 0;
+    for (; n >= 32 && j + 4 <= n; j += 4) {
+        acc0 += fabs(c - x[j]);
+        acc1 += fabs(c - x[j+1]);
+        acc2 += fabs(c - x[j+2]);
+        acc3 += fabs(c - x[j+3]);
+    }
+    for (; j < n; ++j) {
+        acc0 += fabs(c - x[j]);
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+}
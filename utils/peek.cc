@@ -0,0 +1,45 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#include "../indicators.h"
+
+/*
+    The peek of the streams that have no peek of their own: the bar is run on a scratch copy of the stream.
+
+    The scratch stream is kept per thread and per indicator, and overwritten with ti_stream_clone_into,
+    which reuses its buffers, so that repeated peeks at streams of the same options do not allocate.
+    This still copies the whole state on every peek: the streams that are peeked at often should
+    rather declare the peek feature and compute the outputs from their state.
+*/
+
+namespace {
+
+struct peek_scratch {
+    ti_stream *streams[TI_INDICATOR_COUNT] = {0};
+    ~peek_scratch() {
+        for (ti_stream *stream : streams) {
+            if (stream) { ti_stream_free(stream); }
+        }
+    }
+};
+
+thread_local peek_scratch scratch;
+
+}
+
+extern "C" int ti_stream_peek_generic(ti_stream const *stream, TI_REAL const *const *inputs, TI_REAL *const *outputs) {
+    const ti_indicator_info *info = ti_indicators + stream->index;
+    ti_stream *&clone = scratch.streams[stream->index];
+
+    int ret = clone ? info->stream_clone_into(stream, clone) : info->stream_clone(stream, &clone);
+    if (ret != TI_OKAY) {
+        /* a failed clone_into leaves the scratch stream unspecified */
+        if (clone) { info->stream_free(clone); }
+        clone = 0;
+        return ret;
+    }
+    return info->stream_run(clone, 1, inputs, outputs);
+}
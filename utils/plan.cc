@@ -0,0 +1,664 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#include "../indicators.h"
+#include "../indicators/dx.h"
+
+#include <new>
+#include <map>
+#include <tuple>
+#include <vector>
+#include <algorithm>
+
+/*
+    Plan: evaluates a set of (indicator, options) requests in one pass.
+
+    The requests that are known to decompose into common building blocks
+    (true range, directional movement, ema, wilders, sma, rolling max/min)
+    are lowered onto a DAG of nodes. Equal nodes are merged, so that e.g.
+    atr, natr and ce of the same period share the true range and the
+    smoothing, di, dx, adx and adxr share the directional movement, dema,
+    tema, t3 and ema of the same period share the first ema, and willr,
+    stoch, aroon and ichi share the rolling extrema of the highs and lows.
+
+    The DAG is executed block by block: every node fills a block of plan_block
+    bars, then the requests combine the blocks into their outputs. The working
+    set is thus (number of nodes) x plan_block, independent of the series length.
+
+    Any other indicator is evaluated with its plain function at ti_plan_run,
+    which is also where its options get validated.
+*/
+
+namespace {
+
+const int plan_block = 256;
+
+enum op_t {
+    OP_SOURCE, OP_TR, OP_SUB, OP_MID, OP_ABSLAG, OP_GD, OP_EMA, OP_WILDERS, OP_WSUM, OP_SMA, OP_LAG,
+    OP_MAX, OP_MIN, OP_STOCHK, OP_DM, OP_DX
+};
+
+struct node_t {
+    op_t op;
+    int a, b, c;            /* argument nodes, -1 if unused */
+    int period;
+    TI_REAL per;
+    int from;               /* the first bar at which the argument a is defined */
+    TI_REAL const *source;
+
+    /* buf[0] is the last value of the previous block, buf[1+k] is the k-th bar of the current block */
+    std::vector<TI_REAL> buf;
+    /* the second output, laid out as buf: the age of the extremum for OP_MAX/OP_MIN, -DM for OP_DM */
+    std::vector<TI_REAL> aux;
+
+    /* Running state, carried over from block to block */
+    TI_REAL val, sum;
+    std::vector<TI_REAL> ring;
+    std::vector<int> idx;   /* monotonic queue of bar indices for OP_MAX/OP_MIN, ring-indexed */
+    int head, tail;
+    dm_state dm;
+};
+
+struct request_t {
+    int index;
+    TI_REAL const *inputs[TI_MAXINDPARAMS];
+    TI_REAL options[TI_MAXINDPARAMS];
+    TI_REAL *outputs[TI_MAXINDPARAMS];
+    int start;
+    int min_size;           /* the plain function rejects the shorter series */
+    int nodes[4];           /* -1 if the request is not lowered onto the DAG */
+};
+
+}
+
+struct ti_plan {
+    std::vector<node_t> nodes;
+    std::vector<request_t> requests;
+    std::map<std::tuple<int, int, int, int, int, TI_REAL, int, TI_REAL const*>, int> lookup;
+
+    int node(op_t op, int a, int b, int c, int period, TI_REAL per, int from, TI_REAL const *source = 0) {
+        auto key = std::make_tuple((int)op, a, b, c, period, per, from, source);
+        auto it = lookup.find(key);
+        if (it != lookup.end()) { return it->second; }
+
+        node_t n{};
+        n.op = op; n.a = a; n.b = b; n.c = c;
+        n.period = period; n.per = per; n.from = from; n.source = source;
+        if (op != OP_SOURCE) { n.buf.resize(plan_block + 1); }
+        if (op == OP_MAX || op == OP_MIN || op == OP_DM) { n.aux.resize(plan_block + 1); }
+        if (op == OP_SMA || op == OP_LAG) { n.ring.resize(period); }
+        if (op == OP_MAX || op == OP_MIN) { n.ring.resize(period); n.idx.resize(period); }
+
+        nodes.push_back(std::move(n));
+        lookup.emplace(key, (int)nodes.size() - 1);
+        return (int)nodes.size() - 1;
+    }
+    int source(TI_REAL const *ptr) { return node(OP_SOURCE, -1, -1, -1, 0, 0, 0, ptr); }
+    int ema(int a, TI_REAL per, int from) { return node(OP_EMA, a, -1, -1, 0, per, from); }
+    int ema(int a, int period, int from) { return ema(a, 2 / ((TI_REAL)period + 1), from); }
+    int tr(TI_REAL const *const *hlc) { return node(OP_TR, source(hlc[0]), source(hlc[1]), source(hlc[2]), 0, 0, 0); }
+    int max(int a, int period) { return node(OP_MAX, a, -1, -1, period, 0, 0); }
+    int min(int a, int period) { return node(OP_MIN, a, -1, -1, period, 0, 0); }
+    int dm(TI_REAL const *const *hl, int period) {
+        return node(OP_DM, source(hl[0]), source(hl[1]), -1, period, ((TI_REAL)period-1) / ((TI_REAL)period), 0);
+    }
+
+    int lower(request_t &r);
+    void reset();
+    void eval(node_t &n, int b0, int len);
+    void emit(request_t &r, int b0, int len);
+
+    /* Values of a node at the current block, p[-1] being the bar before it */
+    TI_REAL const *row(int i, int b0) {
+        node_t &n = nodes[i];
+        return n.op == OP_SOURCE ? n.source + b0 : n.buf.data() + 1;
+    }
+    TI_REAL const *aux(int i) {
+        return nodes[i].aux.data() + 1;
+    }
+};
+
+int ti_plan::lower(request_t &r) {
+    TI_REAL const *const *in = r.inputs;
+    TI_REAL const *opt = r.options;
+    int *d = r.nodes;
+
+    /* The same checks as in the plain functions */
+    switch (r.index) {
+    case TI_INDICATOR_APO_INDEX:
+    case TI_INDICATOR_PPO_INDEX:
+    case TI_INDICATOR_MACD_INDEX:
+        if ((int)opt[0] < 1) return TI_INVALID_OPTION;
+        if ((int)opt[1] < 2) return TI_INVALID_OPTION;
+        if ((int)opt[1] < (int)opt[0]) return TI_INVALID_OPTION;
+        if (r.index == TI_INDICATOR_MACD_INDEX && (int)opt[2] < 1) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_STOCH_INDEX:
+        if ((int)opt[0] < 1 || (int)opt[1] < 1 || (int)opt[2] < 1) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_ATR_INDEX: case TI_INDICATOR_NATR_INDEX: case TI_INDICATOR_WILDERS_INDEX:
+    case TI_INDICATOR_SMA_INDEX: case TI_INDICATOR_EMA_INDEX: case TI_INDICATOR_DEMA_INDEX:
+    case TI_INDICATOR_TEMA_INDEX: case TI_INDICATOR_TRIX_INDEX: case TI_INDICATOR_MAX_INDEX:
+    case TI_INDICATOR_MIN_INDEX: case TI_INDICATOR_PC_INDEX: case TI_INDICATOR_WILLR_INDEX:
+    case TI_INDICATOR_DM_INDEX: case TI_INDICATOR_DI_INDEX: case TI_INDICATOR_DX_INDEX:
+    case TI_INDICATOR_CE_INDEX: case TI_INDICATOR_CMI_INDEX: case TI_INDICATOR_AROON_INDEX:
+    case TI_INDICATOR_AROONOSC_INDEX:
+        if ((int)opt[0] < 1) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_VI_INDEX:
+        if ((int)opt[0] < 1) return TI_INVALID_OPTION;
+        r.min_size = (int)opt[0] + 1;
+        break;
+    case TI_INDICATOR_ADX_INDEX: case TI_INDICATOR_ADXR_INDEX:
+        if ((int)opt[0] < 2) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_KC_INDEX: case TI_INDICATOR_T3_INDEX:
+        if (opt[0] < 1 || opt[1] < 0) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_ICHI_INDEX:
+        if (!(0 < (int)opt[0] && (int)opt[0] <= (int)opt[1] && (int)opt[1] <= (int)opt[2])) return TI_INVALID_OPTION;
+        break;
+    case TI_INDICATOR_SMI_INDEX:
+        if (opt[0] < 1 || opt[1] < 1 || opt[2] < 1) return TI_INVALID_OPTION;
+        break;
+    default:
+        break;
+    }
+
+    switch (r.index) {
+    case TI_INDICATOR_TR_INDEX:
+        d[0] = tr(in);
+        break;
+    case TI_INDICATOR_ATR_INDEX:
+        d[0] = node(OP_WILDERS, tr(in), -1, -1, (int)opt[0], 0, 0);
+        break;
+    case TI_INDICATOR_NATR_INDEX:
+        d[0] = node(OP_WILDERS, tr(in), -1, -1, (int)opt[0], 0, 0);
+        d[1] = source(in[2]);
+        break;
+    case TI_INDICATOR_WILDERS_INDEX:
+        d[0] = node(OP_WILDERS, source(in[0]), -1, -1, (int)opt[0], 0, 0);
+        break;
+    case TI_INDICATOR_SMA_INDEX:
+        d[0] = node(OP_SMA, source(in[0]), -1, -1, (int)opt[0], 0, 0);
+        break;
+    case TI_INDICATOR_EMA_INDEX:
+        d[0] = ema(source(in[0]), (int)opt[0], 0);
+        break;
+    case TI_INDICATOR_DEMA_INDEX:
+    case TI_INDICATOR_TEMA_INDEX:
+    case TI_INDICATOR_TRIX_INDEX: {
+        const int period = (int)opt[0];
+        d[0] = ema(source(in[0]), period, 0);
+        d[1] = ema(d[0], period, period-1);
+        if (r.index != TI_INDICATOR_DEMA_INDEX) { d[2] = ema(d[1], period, (period-1)*2); }
+        break;
+    }
+    case TI_INDICATOR_APO_INDEX:
+    case TI_INDICATOR_PPO_INDEX:
+        d[0] = ema(source(in[0]), (int)opt[0], 0);
+        d[1] = ema(source(in[0]), (int)opt[1], 0);
+        d[2] = node(OP_SUB, d[0], d[1], -1, 0, 0, 0);
+        break;
+    case TI_INDICATOR_MACD_INDEX: {
+        const int short_period = (int)opt[0];
+        const int long_period = (int)opt[1];
+        TI_REAL short_per = 2 / ((TI_REAL)short_period + 1);
+        TI_REAL long_per = 2 / ((TI_REAL)long_period + 1);
+        if (short_period == 12 && long_period == 26) {
+            short_per = 0.15;
+            long_per = 0.075;
+        }
+        d[0] = node(OP_SUB, ema(source(in[0]), short_per, 0), ema(source(in[0]), long_per, 0), -1, 0, 0, 0);
+        d[1] = ema(d[0], (int)opt[2], long_period-1);
+        break;
+    }
+    case TI_INDICATOR_MAX_INDEX:
+        d[0] = max(source(in[0]), (int)opt[0]);
+        break;
+    case TI_INDICATOR_MIN_INDEX:
+        d[0] = min(source(in[0]), (int)opt[0]);
+        break;
+    case TI_INDICATOR_PC_INDEX:
+        d[0] = min(source(in[1]), (int)opt[0]);
+        d[1] = max(source(in[0]), (int)opt[0]);
+        break;
+    case TI_INDICATOR_WILLR_INDEX:
+        d[0] = max(source(in[0]), (int)opt[0]);
+        d[1] = min(source(in[1]), (int)opt[0]);
+        d[2] = source(in[2]);
+        break;
+    case TI_INDICATOR_AROON_INDEX:
+    case TI_INDICATOR_AROONOSC_INDEX:
+        /* the ages of the extrema over period+1 bars */
+        d[0] = max(source(in[0]), (int)opt[0] + 1);
+        d[1] = min(source(in[1]), (int)opt[0] + 1);
+        break;
+    case TI_INDICATOR_CE_INDEX: {
+        const int period = (int)opt[0];
+        d[0] = max(source(in[0]), period);
+        d[1] = min(source(in[1]), period);
+        d[2] = node(OP_WILDERS, tr(in), -1, -1, period, 0, 0);
+        break;
+    }
+    case TI_INDICATOR_KC_INDEX: {
+        const TI_REAL per = 2 / (opt[0] + 1);
+        d[0] = ema(source(in[2]), per, 0);
+        d[1] = ema(tr(in), per, 0);
+        break;
+    }
+    case TI_INDICATOR_DM_INDEX:
+        d[0] = dm(in, (int)opt[0]);
+        break;
+    case TI_INDICATOR_DI_INDEX: {
+        /* the true range is summed over the bars 1..period-1 like the moves, then smoothed */
+        const int period = (int)opt[0];
+        d[0] = dm(in, period);
+        d[1] = node(OP_WSUM, tr(in), -1, -1, period-1, ((TI_REAL)period-1) / ((TI_REAL)period), 1);
+        break;
+    }
+    case TI_INDICATOR_DX_INDEX:
+        d[0] = node(OP_DX, dm(in, (int)opt[0]), -1, -1, 0, 0, 0);
+        break;
+    case TI_INDICATOR_ADX_INDEX:
+    case TI_INDICATOR_ADXR_INDEX: {
+        /* adx sums the dx of the bars period-1..2*period-2, then smooths them */
+        const int period = (int)opt[0];
+        const int dx = node(OP_DX, dm(in, period), -1, -1, 0, 0, 0);
+        d[0] = node(OP_WSUM, dx, -1, -1, period, ((TI_REAL)period-1) / ((TI_REAL)period), period-1);
+        if (r.index == TI_INDICATOR_ADXR_INDEX) { d[1] = node(OP_LAG, d[0], -1, -1, period-1, 0, 0); }
+        break;
+    }
+    case TI_INDICATOR_VI_INDEX: {
+        const int period = (int)opt[0];
+        d[0] = node(OP_SMA, node(OP_ABSLAG, source(in[0]), source(in[1]), -1, 0, 0, 0), -1, -1, period, 0, 1);
+        d[1] = node(OP_SMA, node(OP_ABSLAG, source(in[1]), source(in[0]), -1, 0, 0, 0), -1, -1, period, 0, 1);
+        d[2] = node(OP_SMA, tr(in), -1, -1, period, 0, 1);
+        break;
+    }
+    case TI_INDICATOR_CMI_INDEX: {
+        const int period = (int)opt[0];
+        const int truerange = tr(in);
+        d[0] = max(truerange, period);
+        d[1] = min(truerange, period);
+        d[2] = node(OP_SMA, truerange, -1, -1, period, 0, 0);
+        break;
+    }
+    case TI_INDICATOR_T3_INDEX: {
+        const TI_REAL per = 2 / (opt[0] + 1);
+        const TI_REAL v = opt[1];
+        int gd = source(in[0]);
+        for (int j = 0; j < 3; ++j) {
+            const int ema1 = ema(gd, per, 0);
+            gd = node(OP_GD, ema1, ema(ema1, per, 0), -1, 0, v, 0);
+        }
+        d[0] = gd;
+        break;
+    }
+    case TI_INDICATOR_ICHI_INDEX: {
+        const int period9 = (int)opt[0];
+        const int period26 = (int)opt[1];
+        const int period52 = (int)opt[2];
+        const int high = source(in[0]), low = source(in[1]);
+        d[0] = node(OP_MID, max(high, period9), min(low, period9), -1, 0, 0, 0);
+        d[1] = node(OP_MID, max(high, period26), min(low, period26), -1, 0, 0, 0);
+        d[2] = node(OP_LAG, node(OP_MID, d[0], d[1], -1, 0, 0, 0), -1, -1, period26, 0, 0);
+        d[3] = node(OP_LAG, node(OP_MID, max(high, period52), min(low, period52), -1, 0, 0, 0), -1, -1, period26, 0, 0);
+        break;
+    }
+    case TI_INDICATOR_SMI_INDEX: {
+        const int q_period = (int)opt[0];
+        const TI_REAL r_per = 2. / (1. + opt[1]);
+        const TI_REAL s_per = 2. / (1. + opt[2]);
+        const int hh = max(source(in[0]), q_period);
+        const int ll = min(source(in[1]), q_period);
+        const int num = node(OP_SUB, source(in[2]), node(OP_MID, hh, ll, -1, 0, 0, 0), -1, 0, 0, 0);
+        const int den = node(OP_SUB, hh, ll, -1, 0, 0, 0);
+        d[0] = ema(ema(num, r_per, q_period-1), s_per, q_period-1);
+        d[1] = ema(ema(den, r_per, q_period-1), s_per, q_period-1);
+        break;
+    }
+    case TI_INDICATOR_STOCH_INDEX: {
+        const int kperiod = (int)opt[0];
+        const int kslow = (int)opt[1];
+        const int dperiod = (int)opt[2];
+        const int kfast = node(OP_STOCHK, source(in[2]),
+            max(source(in[0]), kperiod), min(source(in[1]), kperiod), 0, 0, 0);
+        d[0] = node(OP_SMA, kfast, -1, -1, kslow, 0, kperiod-1);
+        d[1] = node(OP_SMA, d[0], -1, -1, dperiod, 0, kperiod-1 + kslow-1);
+        break;
+    }
+    default:
+        break;
+    }
+    return TI_OKAY;
+}
+
+void ti_plan::reset() {
+    for (node_t &n : nodes) {
+        n.val = 0; n.sum = 0;
+        n.head = 0; n.tail = 0;
+        n.dm = dm_state{};
+        std::fill(n.buf.begin(), n.buf.end(), 0);
+        std::fill(n.aux.begin(), n.aux.end(), 0);
+        std::fill(n.ring.begin(), n.ring.end(), 0);
+    }
+}
+
+void ti_plan::eval(node_t &n, int b0, int len) {
+    if (n.op == OP_SOURCE) { return; }
+
+    /* All the blocks but the last one are full */
+    n.buf[0] = n.buf[plan_block];
+    if (!n.aux.empty()) { n.aux[0] = n.aux[plan_block]; }
+    TI_REAL *out = n.buf.data() + 1;
+    TI_REAL const *a = n.a >= 0 ? row(n.a, b0) : 0;
+    TI_REAL const *b = n.b >= 0 ? row(n.b, b0) : 0;
+    TI_REAL const *c = n.c >= 0 ? row(n.c, b0) : 0;
+
+    switch (n.op) {
+    case OP_TR: /* a, b, c: high, low, close */
+        for (int k = 0; k < len; ++k) { out[k] = b0 + k > 0 ? truerange_of(a[k], b[k], c[k-1]) : a[k] - b[k]; }
+        break;
+    case OP_SUB:
+        for (int k = 0; k < len; ++k) { out[k] = a[k] - b[k]; }
+        break;
+    case OP_MID:
+        for (int k = 0; k < len; ++k) { out[k] = (a[k] + b[k]) / 2.; }
+        break;
+    case OP_ABSLAG: /* |a - b of the bar before|, the vortex movements */
+        for (int k = 0; k < len; ++k) { out[k] = b0 + k > 0 ? fabs(a[k] - b[k-1]) : 0; }
+        break;
+    case OP_GD: /* the generalized dema of t3, v in per */
+        for (int k = 0; k < len; ++k) { out[k] = a[k] * (1+n.per) - b[k] * n.per; }
+        break;
+    case OP_DM: { /* a, b: high, low; +DM in out, -DM in aux, the moves of bars 1..period-1 summed */
+        TI_REAL *down = n.aux.data() + 1;
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k;
+            if (i == 0) { n.dm.first(a[k], b[k]); }
+            else { n.dm.update(a[k], b[k], i < n.period ? 1 : n.per); }
+            out[k] = n.dm.dmup;
+            down[k] = n.dm.dmdown;
+        }
+        break;
+    }
+    case OP_DX: { /* a: OP_DM */
+        TI_REAL const *down = aux(n.a);
+        for (int k = 0; k < len; ++k) { out[k] = dm_dx(a[k], down[k]); }
+        break;
+    }
+    case OP_STOCHK: /* a, b, c: close, max, min */
+        for (int k = 0; k < len; ++k) {
+            const TI_REAL kdiff = b[k] - c[k];
+            out[k] = kdiff == 0.0 ? 0.0 : 100 * ((a[k] - c[k]) / kdiff);
+        }
+        break;
+    case OP_EMA:
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k;
+            if (i == n.from) { n.val = a[k]; }
+            else if (i > n.from) { n.val = (a[k] - n.val) * n.per + n.val; }
+            out[k] = n.val;
+        }
+        break;
+    case OP_WILDERS: {
+        const TI_REAL per = 1.0 / n.period;
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k;
+            if (i < n.period) {
+                n.sum += a[k];
+                if (i == n.period-1) { n.val = n.sum / n.period; }
+            } else {
+                n.val = (a[k] - n.val) * per + n.val;
+            }
+            out[k] = n.val;
+        }
+        break;
+    }
+    case OP_WSUM: /* Wilder's sum: the bars from..from+period-1 are summed, the later ones smoothed by per */
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k - n.from;
+            if (i >= n.period) { n.val = n.val * n.per + a[k]; }
+            else if (i >= 0) { n.val += a[k]; }
+            out[k] = n.val;
+        }
+        break;
+    case OP_LAG: /* a of period bars ago */
+        for (int k = 0; k < len; ++k) {
+            const int slot = (b0 + k) % n.period;
+            out[k] = n.ring[slot];
+            n.ring[slot] = a[k];
+        }
+        break;
+    case OP_SMA: {
+        const TI_REAL scale = 1.0 / n.period;
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k - n.from;
+            if (i >= 0) {
+                const int slot = i % n.period;
+                n.sum += a[k] - n.ring[slot];
+                n.ring[slot] = a[k];
+            }
+            out[k] = n.sum * scale;
+        }
+        break;
+    }
+    case OP_MAX:
+    case OP_MIN: {
+        /* Monotonic queue: the values at idx[head..tail) are decreasing (increasing for min);
+           the newest of the equal values is kept, aux is the age of the extremum */
+        const int M = n.period;
+        const bool is_max = n.op == OP_MAX;
+        TI_REAL *age = n.aux.data() + 1;
+        for (int k = 0; k < len; ++k) {
+            const int i = b0 + k;
+            const TI_REAL x = a[k];
+            while (n.tail > n.head) {
+                const TI_REAL back = n.ring[(n.tail-1) % M];
+                if (is_max ? back <= x : back >= x) { --n.tail; } else { break; }
+            }
+            if (n.tail > n.head && n.idx[n.head % M] <= i - M) { ++n.head; }
+            n.ring[n.tail % M] = x;
+            n.idx[n.tail % M] = i;
+            ++n.tail;
+            out[k] = n.ring[n.head % M];
+            age[k] = i - n.idx[n.head % M];
+        }
+        if (n.head >= M) { n.head -= M; n.tail -= M; }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void ti_plan::emit(request_t &r, int b0, int len) {
+    const int k0 = std::max(r.start - b0, 0);
+    const int o0 = b0 + k0 - r.start;
+    const int *d = r.nodes;
+    TI_REAL const *x = row(d[0], b0);
+    TI_REAL const *y = d[1] >= 0 ? row(d[1], b0) : 0;
+    TI_REAL const *z = d[2] >= 0 ? row(d[2], b0) : 0;
+    TI_REAL *out = r.outputs[0] + o0 - k0;
+
+    switch (r.index) {
+    case TI_INDICATOR_NATR_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = x[k] ? 100 * (x[k]) / y[k] : 0; }
+        break;
+    case TI_INDICATOR_DEMA_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = x[k] * 2 - y[k]; }
+        break;
+    case TI_INDICATOR_TEMA_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = 3 * x[k] - 3 * y[k] + z[k]; }
+        break;
+    case TI_INDICATOR_TRIX_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = z[k] ? (z[k]-z[k-1])/z[k] * 100.0 : 0; }
+        break;
+    case TI_INDICATOR_APO_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = z[k]; }
+        break;
+    case TI_INDICATOR_PPO_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = z[k] ? 100.0 * z[k] / y[k] : 0; }
+        break;
+    case TI_INDICATOR_MACD_INDEX: {
+        TI_REAL *signal = r.outputs[1] + o0 - k0;
+        TI_REAL *hist = r.outputs[2] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k];
+            signal[k] = y[k];
+            hist[k] = x[k] - y[k];
+        }
+        break;
+    }
+    case TI_INDICATOR_WILLR_INDEX:
+        for (int k = k0; k < len; ++k) {
+            const TI_REAL highlow = x[k] - y[k];
+            out[k] = highlow == 0.0 ? 0.0 : -100 * ((x[k] - z[k]) / highlow);
+        }
+        break;
+    case TI_INDICATOR_AROON_INDEX: {
+        const int period = (int)r.options[0];
+        const TI_REAL scale = 100.0 / period;
+        TI_REAL const *maxage = aux(d[0]), *minage = aux(d[1]);
+        TI_REAL *aup = r.outputs[1] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = ((TI_REAL)period - minage[k]) * scale;
+            aup[k] = ((TI_REAL)period - maxage[k]) * scale;
+        }
+        break;
+    }
+    case TI_INDICATOR_AROONOSC_INDEX: {
+        const TI_REAL scale = 100.0 / (int)r.options[0];
+        TI_REAL const *maxage = aux(d[0]), *minage = aux(d[1]);
+        for (int k = k0; k < len; ++k) { out[k] = (minage[k] - maxage[k]) * scale; }
+        break;
+    }
+    case TI_INDICATOR_CE_INDEX: {
+        const TI_REAL coef = r.options[1];
+        TI_REAL *ce_low = r.outputs[1] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k] - coef * z[k];
+            ce_low[k] = y[k] + coef * z[k];
+        }
+        break;
+    }
+    case TI_INDICATOR_KC_INDEX: {
+        const TI_REAL multiple = r.options[1];
+        TI_REAL *kc_middle = r.outputs[1] + o0 - k0;
+        TI_REAL *kc_upper = r.outputs[2] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k] - multiple * y[k];
+            kc_middle[k] = x[k];
+            kc_upper[k] = x[k] + multiple * y[k];
+        }
+        break;
+    }
+    case TI_INDICATOR_DM_INDEX: {
+        TI_REAL const *down = aux(d[0]);
+        TI_REAL *minus_dm = r.outputs[1] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k];
+            minus_dm[k] = down[k];
+        }
+        break;
+    }
+    case TI_INDICATOR_DI_INDEX: {
+        TI_REAL const *down = aux(d[0]);
+        TI_REAL *minus_di = r.outputs[1] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k] ? 100.0 * x[k] / y[k] : 0;
+            minus_di[k] = down[k] ? 100.0 * down[k] / y[k] : 0;
+        }
+        break;
+    }
+    case TI_INDICATOR_ADX_INDEX: {
+        const TI_REAL invper = 1.0 / ((TI_REAL)(int)r.options[0]);
+        for (int k = k0; k < len; ++k) { out[k] = x[k] * invper; }
+        break;
+    }
+    case TI_INDICATOR_ADXR_INDEX: {
+        /* y is the adx sum of period-1 bars ago */
+        const TI_REAL invper = 1.0 / ((TI_REAL)(int)r.options[0]);
+        for (int k = k0; k < len; ++k) { out[k] = 0.5 * (x[k] * invper + y[k] * invper); }
+        break;
+    }
+    case TI_INDICATOR_VI_INDEX: {
+        /* the averages in place of the sums, the period cancels out */
+        TI_REAL *vi_m = r.outputs[1] + o0 - k0;
+        for (int k = k0; k < len; ++k) {
+            out[k] = x[k] ? x[k] / z[k] : 0;
+            vi_m[k] = y[k] ? y[k] / z[k] : 0;
+        }
+        break;
+    }
+    case TI_INDICATOR_CMI_INDEX: {
+        const int period = (int)r.options[0];
+        for (int k = k0; k < len; ++k) { out[k] = log((x[k] - y[k]) / (z[k] * period)) / log(period) * 100; }
+        break;
+    }
+    case TI_INDICATOR_SMI_INDEX:
+        for (int k = k0; k < len; ++k) { out[k] = y[k] ? 100 * x[k] / (0.5 * y[k]) : 0; }
+        break;
+    default: /* the outputs are the nodes themselves */
+        for (int j = 0; j < 4 && j < ti_indicators[r.index].outputs; ++j) {
+            TI_REAL const *v = row(d[j], b0);
+            std::copy(v + k0, v + len, r.outputs[j] + o0);
+        }
+        break;
+    }
+}
+
+int ti_plan_new(ti_plan **plan) {
+    *plan = new(std::nothrow) ti_plan();
+    return *plan ? TI_OKAY : TI_OUT_OF_MEMORY;
+}
+
+int ti_plan_add(ti_plan *plan, int index, TI_REAL const *const *inputs, TI_REAL const *options, TI_REAL *const *outputs) {
+    if (index < 0 || index >= TI_INDICATOR_COUNT) { return TI_INVALID_OPTION; }
+    const ti_indicator_info *info = ti_indicators + index;
+
+    try {
+        request_t r{};
+        r.index = index;
+        std::copy(inputs, inputs + info->inputs, r.inputs);
+        std::copy(options, options + info->options, r.options);
+        std::copy(outputs, outputs + info->outputs, r.outputs);
+        r.start = info->start(options);
+        std::fill(r.nodes, r.nodes + 4, -1);
+        const int ret = plan->lower(r);
+        if (ret != TI_OKAY) { return ret; }
+        plan->requests.push_back(r);
+    } catch (std::bad_alloc& e) {
+        return TI_OUT_OF_MEMORY;
+    }
+    return TI_OKAY;
+}
+
+int ti_plan_run(ti_plan *plan, int size) {
+    for (request_t &r : plan->requests) {
+        if (r.nodes[0] >= 0 && size < r.min_size) { return TI_INVALID_OPTION; }
+        if (r.nodes[0] < 0) {
+            const int ret = ti_indicators[r.index].indicator(size, r.inputs, r.options, r.outputs);
+            if (ret != TI_OKAY) { return ret; }
+        }
+    }
+
+    plan->reset();
+    for (int b0 = 0; b0 < size; b0 += plan_block) {
+        const int len = std::min(plan_block, size - b0);
+        /* Nodes are created after their arguments, so this is a topological order */
+        for (node_t &n : plan->nodes) { plan->eval(n, b0, len); }
+        for (request_t &r : plan->requests) {
+            if (r.nodes[0] >= 0 && b0 + len > r.start) { plan->emit(r, b0, len); }
+        }
+    }
+    return TI_OKAY;
+}
+
+void ti_plan_free(ti_plan *plan) {
+    delete plan;
+}
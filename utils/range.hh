@@ -0,0 +1,32 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+
+/*
+    Helpers for the ti_xxx_range functions, which compute the outputs
+    first_output..first_output+count-1 of ti_xxx only, into outputs[j][0..count-1].
+
+    range_check(): validates the requested slice against the input size
+    range_window(): for the indicators whose output depends on the last start+1 bars
+        only, the slice is the plain function over just the bars that cover it
+*/
+
+inline bool range_check(int size, int start, int first_output, int count) {
+    return first_output >= 0 && count >= 0 && start + first_output + count <= size;
+}
+
+template<class F>
+int range_window(F plain, int ninputs, int size, TI_REAL const *const *inputs, TI_REAL const *options, int start, int first_output, int count, TI_REAL *const *outputs) {
+    if (!range_check(size, start, first_output, count)) { return TI_INVALID_OPTION; }
+
+    TI_REAL const *window[TI_MAXINDPARAMS];
+    for (int j = 0; j < ninputs; ++j) { window[j] = inputs[j] + first_output; }
+
+    return plain(start + count, window, options, outputs);
+}
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <iterator>
 #include <functional>
+#include <vector>
 
 /*
     Ring buffer: https://en.wikipedia.org/wiki/Circular_buffer
@@ -123,11 +124,27 @@ struct ringbuf<2> {
 /* Runtime-sized, alloc'd at the heap */
 template<>
 struct ringbuf<0> {
-    int M;
+    int M = 0;
     int pos = 0;
     std::unique_ptr<TI_REAL[]> buf;
     explicit ringbuf() = default;
     explicit ringbuf(int M_) { resize(M_); }
+    ringbuf(ringbuf&&) = default;
+    ringbuf& operator=(ringbuf&&) = default;
+    ringbuf(const ringbuf& other) { *this = other; }
+    ringbuf& operator=(const ringbuf& other) {
+        if (this == &other) { return *this; }
+        if (!other.buf) {
+            buf.reset();
+        } else {
+            /* reuse the storage when the size matches, so that copying between streams does not allocate */
+            if (!buf || M != other.M) { buf = std::make_unique<TI_REAL[]>(other.M); }
+            std::memcpy(buf.get(), other.buf.get(), other.M*sizeof(TI_REAL));
+        }
+        M = other.M;
+        pos = other.pos;
+        return *this;
+    }
     void resize(int M_) {
         assert(M_ > 0);
         M = M_;
@@ -188,6 +205,100 @@ struct ringbuf<0> {
 };
 
 
+/*
+    Ring buffer that also keeps the rolling max and min of its window: https://en.wikipedia.org/wiki/Sliding_window_minimum
+    (two monotonic deques of the stamps of the values that may still become the extremum).
+
+    operator=(): assign the current value once per step(), the deques are updated right away
+    find_max(period), find_min(period): O(1) for the whole window, O(log window) for a shorter period;
+        return a pointer into the buffer just like ringbuf does, so iterator_to_age() applies
+    Only the values assigned since construction/resize() are considered.
+*/
+template<int N>
+struct ringbuf_minmax : ringbuf<N> {
+    static_assert(N != 2, "ringbuf<2> has no position to age the values by");
+
+    struct monotonic {
+        std::vector<unsigned> q; /* stamps, a ring of the window size, oldest at head */
+        int head = 0;
+        int n = 0;
+        unsigned& at(int i) {
+            int k = head + i;
+            if (k >= int(q.size())) { k -= q.size(); }
+            return q[k];
+        }
+        void reset(int window) {
+            q.assign(window, 0);
+            head = 0;
+            n = 0;
+        }
+    };
+
+    /* stamp of the current value; after step() the deques may hold one stamp of age window, dropped at the next push.
+       The stamps wrap around modulo 2^32, only their differences, the ages, are used. */
+    unsigned t = 0;
+    monotonic maxq, minq;
+
+    ringbuf_minmax() { if (N > 0) { reset(N); } }
+    void resize(int M_) {
+        ringbuf<N>::resize(M_);
+        reset(M_);
+    }
+
+    int window() const { return maxq.q.size(); }
+    int age(unsigned stamp) const { return int(t - stamp); }
+    TI_REAL* at_age(int age) {
+        int k = this->pos + age;
+        if (k >= window()) { k -= window(); }
+        return this->phbegin() + k;
+    }
+
+    void operator=(TI_REAL x) {
+        ringbuf<N>::operator=(x);
+        push<std::less_equal<TI_REAL>>(maxq, x);
+        push<std::greater_equal<TI_REAL>>(minq, x);
+    }
+    void step() {
+        ringbuf<N>::step();
+        t += 1;
+    }
+
+    TI_REAL* find_max(int period) { return find(maxq, period); }
+    TI_REAL* find_min(int period) { return find(minq, period); }
+
+private:
+    void reset(int window) {
+        t = 0;
+        maxq.reset(window);
+        minq.reset(window);
+    }
+
+    template<class Dominated>
+    void push(monotonic &m, TI_REAL x) {
+        assert(m.n == 0 || m.at(m.n-1) != t);
+        Dominated dominated;
+        while (m.n && age(m.at(0)) >= window()) { m.head = m.head + 1 == window() ? 0 : m.head + 1; m.n -= 1; }
+        while (m.n && dominated(*at_age(age(m.at(m.n-1))), x)) { m.n -= 1; }
+        m.at(m.n) = t;
+        m.n += 1;
+    }
+
+    TI_REAL* find(monotonic &m, int period) {
+        assert(period > 0 && period <= window());
+        assert(m.n > 0);
+        /* the head is the extremum of the whole window */
+        if (age(m.at(0)) < period) { return at_age(age(m.at(0))); }
+        /* the stamps grow from head to tail, look for the oldest one within the period */
+        int lo = 0, hi = m.n - 1;
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if (age(m.at(mid)) < period) { hi = mid; } else { lo = mid + 1; }
+        }
+        return at_age(age(m.at(lo)));
+    }
+};
+
+
 template<class T>
 void step(T& arg) {
     arg.step();
@@ -0,0 +1,266 @@
+/*
+ * This file is part of tindicators, licensed under GNU LGPL v3.
+ * Author: agent <agent@local>, 2026
+ */
+
+
+#pragma once
+
+#include "../indicators.h"
+#include "ringbuf.hh"
+#include "orderstat.hh"
+#include "hull.hh"
+
+#include <new>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <deque>
+#include <set>
+#include <queue>
+
+/*
+    Flat binary (de)serialization of the stream state, used by ti_xxx_stream_save/ti_xxx_stream_load.
+
+    stream_writer: appends raw bytes to buf, or only counts them when buf is null
+    stream_reader: reads raw bytes back, turns ok off on the first out-of-bounds read
+    stream_io(): one overload per kind of member; trivially copyable members (scalars, ringbuf<N>,
+        the plain state structs) are stored as is, the heap-backed ones as a length and the elements
+    stream_base: the base of the streams, keeps the options the stream was created with
+    STREAM_IO(name, members...): defines ti_name_stream_save/ti_name_stream_load over the listed members,
+        and ti_name_stream_clone/ti_name_stream_clone_into over the copy constructor/assignment of the stream
+
+    The options are saved ahead of the members, and load makes the stream anew with ti_name_stream_new,
+    so that the options are checked and the constants derived from them are recomputed rather than
+    trusted. Thus only the mutable state is listed, and the heap-backed members must be read back at
+    the sizes ti_name_stream_new allocated them with. stream_restore() may rebuild what is derived from the
+    listed members, such as the orderstat over a ring, and stream_valid() may check whatever else the state of
+    a stream has to agree on.
+
+    The layout is native-endian and is only guaranteed to be read back by the same TI_STREAM_FORMAT_VERSION.
+*/
+
+struct stream_base : ti_stream {
+    TI_REAL created_with[TI_MAXINDPARAMS];
+
+    /* call right after setting the index */
+    void keep_options(TI_REAL const *options) {
+        const int n = ti_indicators[index].options;
+        std::copy(options, options + n, created_with);
+        std::fill(created_with + n, created_with + TI_MAXINDPARAMS, 0.);
+    }
+};
+
+struct stream_writer {
+    char *buf;
+    size_t size = 0;
+    void bytes(void const *src, size_t n) {
+        if (buf) { std::memcpy(buf + size, src, n); }
+        size += n;
+    }
+};
+
+struct stream_reader {
+    char const *buf;
+    size_t size;
+    size_t pos = 0;
+    bool ok = true;
+    void bytes(void *dst, size_t n) {
+        if (!ok || n > size - pos) { ok = false; return; }
+        std::memcpy(dst, buf + pos, n);
+        pos += n;
+    }
+    bool fits(uint64_t count, size_t elem) const {
+        return ok && count <= (size - pos) / elem;
+    }
+};
+
+template<class T, std::enable_if_t<std::is_trivially_copyable<T>::value, int> = 0>
+void stream_io(stream_writer &ar, T &x) { ar.bytes(&x, sizeof(T)); }
+template<class T, std::enable_if_t<std::is_trivially_copyable<T>::value, int> = 0>
+void stream_io(stream_reader &ar, T &x) { ar.bytes(&x, sizeof(T)); }
+
+inline void stream_io(stream_writer &ar, ringbuf<0> &x) {
+    int M = x.buf ? x.M : 0;
+    ar.bytes(&M, sizeof(M));
+    ar.bytes(&x.pos, sizeof(x.pos));
+    ar.bytes(x.buf.get(), sizeof(TI_REAL) * M);
+}
+inline void stream_io(stream_reader &ar, ringbuf<0> &x) {
+    int M, pos;
+    ar.bytes(&M, sizeof(M));
+    ar.bytes(&pos, sizeof(pos));
+    if (!ar.ok) { return; }
+    if (M != (x.buf ? x.M : 0)) { ar.ok = false; return; }
+    if (M == 0) { return; }
+    if (pos < 0 || pos >= M) { ar.ok = false; return; }
+    x.pos = pos;
+    ar.bytes(x.buf.get(), sizeof(TI_REAL) * M);
+}
+
+inline void stream_io(stream_writer &ar, ringbuf_minmax<0> &x) {
+    stream_io(ar, static_cast<ringbuf<0>&>(x));
+    ar.bytes(&x.t, sizeof(x.t));
+    for (auto *m : {&x.maxq, &x.minq}) {
+        ar.bytes(&m->head, sizeof(m->head));
+        ar.bytes(&m->n, sizeof(m->n));
+        for (int i = 0; i < m->n; ++i) { ar.bytes(&m->at(i), sizeof(unsigned)); }
+    }
+}
+inline void stream_io(stream_reader &ar, ringbuf_minmax<0> &x) {
+    stream_io(ar, static_cast<ringbuf<0>&>(x));
+    ar.bytes(&x.t, sizeof(x.t));
+    if (!ar.ok) { return; }
+    const int window = x.buf ? x.M : 0;
+    for (auto *m : {&x.maxq, &x.minq}) {
+        m->reset(window);
+        ar.bytes(&m->head, sizeof(m->head));
+        ar.bytes(&m->n, sizeof(m->n));
+        if (!ar.ok || m->head < 0 || m->n < 0 || m->n > window || (window && m->head >= window)) { ar.ok = false; return; }
+        for (int i = 0; i < m->n; ++i) {
+            ar.bytes(&m->at(i), sizeof(unsigned));
+            if (!ar.ok || x.t - m->at(i) > unsigned(window)) { ar.ok = false; return; }
+        }
+    }
+}
+
+/* a rolling orderstat or sorted_window holds the last n values of its ring, those are put back from the ring rather than saved */
+template<class Window>
+void orderstat_refill(Window &x, ringbuf<0> const &ring, int n) {
+    n = std::max(0, std::min(n, ring.M - 1));
+    x.reserve(x.capacity());
+    for (int i = 1; i <= n; ++i) { x.insert(ring[i]); }
+}
+
+template<class C>
+void stream_io_sequence(stream_writer &ar, C &c) {
+    uint64_t count = c.size();
+    ar.bytes(&count, sizeof(count));
+    for (auto &x : c) { ar.bytes(&x, sizeof(x)); }
+}
+template<class C>
+void stream_io_sequence(stream_reader &ar, C &c) {
+    uint64_t count;
+    ar.bytes(&count, sizeof(count));
+    if (!ar.fits(count, sizeof(typename C::value_type))) { ar.ok = false; return; }
+    c.clear();
+    for (uint64_t i = 0; i < count; ++i) {
+        typename C::value_type x;
+        ar.bytes(&x, sizeof(x));
+        c.insert(c.end(), x);
+    }
+}
+
+template<class T> void stream_io(stream_writer &ar, std::vector<T> &x) { stream_io_sequence(ar, x); }
+template<class T> void stream_io(stream_reader &ar, std::vector<T> &x) {
+    const size_t allocated = x.size();
+    stream_io_sequence(ar, x);
+    if (x.size() != allocated) { ar.ok = false; }
+}
+
+/* the two stacks of both hulls as they are, the undo log refers to the positions in front */
+template<class Ar>
+void stream_io_chain(Ar &ar, sliding_hull::chain &c) {
+    stream_io_sequence(ar, c.pending);
+    stream_io_sequence(ar, c.back);
+    stream_io_sequence(ar, c.front);
+    stream_io_sequence(ar, c.log);
+    ar.bytes(&c.n, sizeof(c.n));
+}
+inline void stream_io(stream_writer &ar, sliding_hull &x) {
+    stream_io_chain(ar, x.upper);
+    stream_io_chain(ar, x.lower);
+}
+inline void stream_io(stream_reader &ar, sliding_hull &x) {
+    for (auto *c : {&x.upper, &x.lower}) {
+        const int capacity = c->front.size();
+        stream_io_chain(ar, *c);
+        if (!ar.ok) { return; }
+
+        bool ok = (int)c->front.size() == capacity && c->size() <= capacity && c->back.size() <= c->pending.size();
+
+        /* each entry of the log holds the length of the front before it was pushed and the position it took, */
+        /* so the first one starts from an empty front and each next one from where the previous one left it */
+        int n = 0;
+        for (auto &u : c->log) {
+            ok = ok && u.n == n && u.pos >= 0 && u.pos <= u.n && u.pos < capacity;
+            n = u.pos + 1;
+        }
+        ok = ok && c->n == n;
+        if (!ok) { ar.ok = false; return; }
+    }
+}
+template<class Ar, class T> void stream_io(Ar &ar, std::deque<T> &x) { stream_io_sequence(ar, x); }
+template<class Ar, class T> void stream_io(Ar &ar, std::multiset<T> &x) { stream_io_sequence(ar, x); }
+
+/* std::queue hides its container, a derived class may reach it */
+template<class T>
+struct stream_queue_access : std::queue<T> {
+    static std::deque<T>& get(std::queue<T> &q) { return q.*(&stream_queue_access::c); }
+};
+template<class Ar, class T> void stream_io(Ar &ar, std::queue<T> &x) { stream_io_sequence(ar, stream_queue_access<T>::get(x)); }
+
+template<class Ar, class... Ts>
+void stream_io_all(Ar &ar, Ts&... xs) {
+    (stream_io(ar, xs), ...);
+}
+
+/* a stream may overload these to rebuild what is derived from its loaded state, and to check it further */
+template<class S> void stream_restore(S &) {}
+template<class S> bool stream_valid(S const &) { return true; }
+
+#define STREAM_IO(name, ...) \
+    template<class Ar> \
+    static void ti_##name##_stream_io(Ar &ar, ti_##name##_stream &s) { \
+        stream_io_all(ar, s.progress, __VA_ARGS__); \
+    } \
+    size_t ti_##name##_stream_save(ti_stream *stream, void *buf) { \
+        ti_##name##_stream *ptr = static_cast<ti_##name##_stream*>(stream); \
+        stream_writer ar{static_cast<char*>(buf)}; \
+        ar.bytes(ptr->created_with, sizeof(TI_REAL) * ti_indicators[ptr->index].options); \
+        ti_##name##_stream_io(ar, *ptr); \
+        return ar.size; \
+    } \
+    int ti_##name##_stream_load(void const *buf, size_t size, ti_stream **stream) { \
+        const ti_indicator_info *info = ti_find_indicator(#name); \
+        stream_reader ar{static_cast<char const*>(buf), size}; \
+        TI_REAL options[TI_MAXINDPARAMS] = {0}; \
+        ar.bytes(options, sizeof(TI_REAL) * info->options); \
+        if (!ar.ok) { return TI_INVALID_OPTION; } \
+        ti_stream *fresh; \
+        const int ret = ti_##name##_stream_new(options, &fresh); \
+        if (ret != TI_OKAY) { return ret; } \
+        ti_##name##_stream *ptr = static_cast<ti_##name##_stream*>(fresh); \
+        const int first_progress = ptr->progress; \
+        try { \
+            ti_##name##_stream_io(ar, *ptr); \
+        } catch (std::bad_alloc& e) { \
+            ti_##name##_stream_free(ptr); \
+            return TI_OUT_OF_MEMORY; \
+        } \
+        if (ar.ok && ar.pos == size && ptr->progress >= first_progress) { stream_restore(*ptr); } \
+        if (!ar.ok || ar.pos != size || ptr->progress < first_progress || !stream_valid(*ptr)) { \
+            ti_##name##_stream_free(ptr); \
+            return TI_INVALID_OPTION; \
+        } \
+        *stream = ptr; \
+        return TI_OKAY; \
+    } \
+    int ti_##name##_stream_clone(ti_stream const *stream, ti_stream **clone) { \
+        try { \
+            *clone = new ti_##name##_stream(*static_cast<ti_##name##_stream const*>(stream)); \
+        } catch (std::bad_alloc& e) { \
+            return TI_OUT_OF_MEMORY; \
+        } \
+        return TI_OKAY; \
+    } \
+    int ti_##name##_stream_clone_into(ti_stream const *stream, ti_stream *clone) { \
+        try { \
+            *static_cast<ti_##name##_stream*>(clone) = *static_cast<ti_##name##_stream const*>(stream); \
+        } catch (std::bad_alloc& e) { \
+            return TI_OUT_OF_MEMORY; \
+        } \
+        return TI_OKAY; \
+    }